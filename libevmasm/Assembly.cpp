@@ -33,6 +33,8 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Profiler.h>
+
 #include <fstream>
 #include <json/json.h>
 
@@ -394,6 +396,7 @@ Assembly& Assembly::optimise(bool _enable, EVMVersion _evmVersion, bool _isCreat
 
 Assembly& Assembly::optimise(OptimiserSettings const& _settings)
 {
+	util::ScopedTimer timer{"EVM assembly optimiser"};
 	optimiseInternal(_settings, {});
 	return *this;
 }
@@ -424,6 +427,8 @@ map<u256, u256> Assembly::optimiseInternal(
 		count = 0;
 
 		if (_settings.runInliner)
+		{
+			util::ScopedTimer timer{"Inliner"};
 			Inliner{
 				m_items,
 				_tagsReferencedFromOutside,
@@ -431,9 +436,11 @@ map<u256, u256> Assembly::optimiseInternal(
 				_settings.isCreation,
 				_settings.evmVersion
 			}.optimise();
+		}
 
 		if (_settings.runJumpdestRemover)
 		{
+			util::ScopedTimer timer{"JumpdestRemover"};
 			JumpdestRemover jumpdestOpt{m_items};
 			if (jumpdestOpt.optimise(_tagsReferencedFromOutside))
 				count++;
@@ -441,6 +448,7 @@ map<u256, u256> Assembly::optimiseInternal(
 
 		if (_settings.runPeephole)
 		{
+			util::ScopedTimer timer{"PeepholeOptimiser"};
 			PeepholeOptimiser peepOpt{m_items};
 			while (peepOpt.optimise())
 			{
@@ -452,6 +460,7 @@ map<u256, u256> Assembly::optimiseInternal(
 		// This only modifies PushTags, we have to run again to actually remove code.
 		if (_settings.runDeduplicate)
 		{
+			util::ScopedTimer timer{"BlockDeduplicator"};
 			BlockDeduplicator deduplicator{m_items};
 			if (deduplicator.deduplicate())
 			{
@@ -480,6 +489,7 @@ map<u256, u256> Assembly::optimiseInternal(
 			// Control flow graph optimization has been here before but is disabled because it
 			// assumes we only jump to tags that are pushed. This is not the case anymore with
 			// function types that can be stored in storage.
+			util::ScopedTimer timer{"CommonSubexpressionEliminator"};
 			AssemblyItems optimisedItems;
 
 			bool usesMSize = (find(m_items.begin(), m_items.end(), AssemblyItem{Instruction::MSIZE}) != m_items.end());
@@ -526,12 +536,16 @@ map<u256, u256> Assembly::optimiseInternal(
 	}
 
 	if (_settings.runConstantOptimiser)
+	{
+		util::ScopedTimer timer{"ConstantOptimiser"};
 		ConstantOptimisationMethod::optimiseConstants(
 			_settings.isCreation,
 			_settings.isCreation ? 1 : _settings.expectedExecutionsPerDeployment,
 			_settings.evmVersion,
-			*this
+			*this,
+			_settings.constantOptimiserCache
 		);
+	}
 
 	return tagReplacements;
 }
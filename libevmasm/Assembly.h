@@ -39,6 +39,7 @@
 namespace solidity::evmasm
 {
 
+class ConstantOptimiserCache;
 using AssemblyPointer = std::shared_ptr<Assembly>;
 
 class Assembly
@@ -119,6 +120,9 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = 200;
+		/// If set, the decisions of the constant optimiser are shared with other assemblies
+		/// optimised with the same cache.
+		ConstantOptimiserCache* constantOptimiserCache = nullptr;
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
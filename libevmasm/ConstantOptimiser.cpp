@@ -32,7 +32,8 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 	bool _isCreation,
 	size_t _runs,
 	langutil::EVMVersion _evmVersion,
-	Assembly& _assembly
+	Assembly& _assembly,
+	ConstantOptimiserCache* _cache
 )
 {
 	// TODO: design the optimiser in a way this is not needed
@@ -54,22 +55,52 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 		params.isCreation = _isCreation;
 		params.runs = _runs;
 		params.evmVersion = _evmVersion;
-		LiteralMethod lit(params, item.data());
-		bigint literalGas = lit.gasNeeded();
-		CodeCopyMethod copy(params, item.data());
-		bigint copyGas = copy.gasNeeded();
-		ComputeMethod compute(params, item.data());
-		bigint computeGas = compute.gasNeeded();
-		AssemblyItems replacement;
-		if (copyGas < literalGas && copyGas < computeGas)
+
+		using Representation = ConstantOptimiserCache::Representation;
+		auto findRepresentation = [&]() {
+			Representation representation;
+			LiteralMethod lit(params, item.data());
+			bigint literalGas = lit.gasNeeded();
+			CodeCopyMethod copy(params, item.data());
+			bigint copyGas = copy.gasNeeded();
+			ComputeMethod compute(params, item.data());
+			bigint computeGas = compute.gasNeeded();
+			if (copyGas < literalGas && copyGas < computeGas)
+				representation.method = Representation::Method::CodeCopy;
+			else if (computeGas < literalGas && computeGas <= copyGas)
+			{
+				representation.method = Representation::Method::Compute;
+				representation.routine = compute.execute(_assembly);
+			}
+			return representation;
+		};
+		Representation uncached;
+		Representation const* representation = &uncached;
+		if (_cache)
 		{
-			replacement = copy.execute(_assembly);
-			optimisations++;
+			ConstantOptimiserCache::Key key{item.data(), _evmVersion, _runs, _isCreation, it.second};
+			auto cached = _cache->m_representations.find(key);
+			if (cached == _cache->m_representations.end())
+				cached = _cache->m_representations.emplace(move(key), findRepresentation()).first;
+			representation = &cached->second;
 		}
-		else if (computeGas < literalGas && computeGas <= copyGas)
+		else
+			uncached = findRepresentation();
+
+		AssemblyItems replacement;
+		switch (representation->method)
 		{
-			replacement = compute.execute(_assembly);
+		case Representation::Method::Literal:
+			break;
+		case Representation::Method::CodeCopy:
+			// Appends to the data section, so this cannot be cached.
+			replacement = CodeCopyMethod(params, item.data()).execute(_assembly);
 			optimisations++;
+			break;
+		case Representation::Method::Compute:
+			replacement = representation->routine;
+			optimisations++;
+			break;
 		}
 		if (!replacement.empty())
 			pendingReplacements[item.data()] = replacement;
@@ -22,21 +22,46 @@
 
 #pragma once
 
+#include <libevmasm/AssemblyItem.h>
 #include <libevmasm/Exceptions.h>
 
 #include <liblangutil/EVMVersion.h>
 
 #include <libsolutil/Assertions.h>
 
+#include <map>
+#include <tuple>
 #include <vector>
 
 namespace solidity::evmasm
 {
 
-class AssemblyItem;
-using AssemblyItems = std::vector<AssemblyItem>;
 class Assembly;
 
+/**
+ * Representations chosen by the constant optimiser. The choice only depends on the value, the
+ * number of occurrences and the optimisation parameters, so it can be shared by all assemblies of
+ * a compilation, which typically contain the same masks and selectors.
+ * Is not thread-safe and should not outlive the compilation it is used for.
+ */
+class ConstantOptimiserCache
+{
+private:
+	friend class ConstantOptimisationMethod;
+
+	struct Representation
+	{
+		enum class Method { Literal, CodeCopy, Compute };
+		Method method = Method::Literal;
+		/// The routine computing the constant, only used for ``Method::Compute``.
+		AssemblyItems routine;
+	};
+	/// Value, EVM version, runs, creation flag and multiplicity of a constant.
+	using Key = std::tuple<u256, langutil::EVMVersion, size_t, bool, size_t>;
+
+	std::map<Key, Representation> m_representations;
+};
+
 /**
  * Abstract base class for one way to change how constants are represented in the code.
  */
@@ -45,12 +70,14 @@ class ConstantOptimisationMethod
 public:
 	/// Tries to optimised how constants are represented in the source code and modifies
 	/// @a _assembly.
+	/// If @a _cache is given, the chosen representations are stored in and taken from it.
 	/// @returns zero if no optimisations could be performed.
 	static unsigned optimiseConstants(
 		bool _isCreation,
 		size_t _runs,
 		langutil::EVMVersion _evmVersion,
-		Assembly& _assembly
+		Assembly& _assembly,
+		ConstantOptimiserCache* _cache = nullptr
 	);
 
 protected:
@@ -57,16 +57,6 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::langutil;
 
-char CharStream::advanceAndGet(size_t _chars)
-{
-	if (isPastEndOfInput())
-		return 0;
-	m_position += _chars;
-	if (isPastEndOfInput())
-		return 0;
-	return m_source[m_position];
-}
-
 char CharStream::rollback(size_t _amount)
 {
 	solAssert(m_position >= _amount, "");
@@ -76,7 +76,15 @@ public:
 	bool isPastEndOfInput(size_t _charsForward = 0) const { return (m_position + _charsForward) >= m_source.size(); }
 
 	char get(size_t _charsForward = 0) const { return m_source[m_position + _charsForward]; }
-	char advanceAndGet(size_t _chars = 1);
+	char advanceAndGet(size_t _chars = 1)
+	{
+		if (isPastEndOfInput())
+			return 0;
+		m_position += _chars;
+		if (isPastEndOfInput())
+			return 0;
+		return m_source[m_position];
+	}
 	/// Sets scanner position to @ _amount characters backwards in source text.
 	/// @returns The character of the current location after update is returned.
 	char rollback(size_t _amount);
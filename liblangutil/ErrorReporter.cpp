@@ -78,6 +78,23 @@ void ErrorReporter::error(ErrorId _errorId, Error::Type _type, SourceLocation co
 	m_errorList.push_back(make_shared<Error>(_errorId, _type, _description, _location, _secondaryLocation));
 }
 
+void ErrorReporter::merge(ErrorList const& _errorList)
+{
+	for (auto const& error: _errorList)
+		if (error->errorId() == 4591_error)
+			// Reported again below once there are too many warnings in total.
+			continue;
+		else if (error->errorId() == 4013_error)
+		{
+			// The other reporter aborted at one error too many (of whatever non-warning
+			// type), which is also one too many in total.
+			checkForExcessiveErrors(Error::Type::ParserError);
+			solAssert(false, "Excessive errors not detected.");
+		}
+		else if (!checkForExcessiveErrors(error->type()))
+			m_errorList.push_back(error);
+}
+
 bool ErrorReporter::hasExcessiveErrors() const
 {
 	return m_errorCount > c_maxErrorsAllowed;
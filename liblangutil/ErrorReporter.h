@@ -47,11 +47,19 @@ public:
 
 	ErrorReporter& operator=(ErrorReporter const& _errorReporter);
 
+	/// Appends the errors of another reporter without counting them towards the limits
+	/// of this reporter. Use merge() for parts of the same compilation step.
 	void append(ErrorList const& _errorList)
 	{
 		m_errorList += _errorList;
 	}
 
+	/// Appends the errors collected by another reporter for a part of the same compilation step,
+	/// e.g. one that ran in another thread, as if they had been reported here. The limits on the
+	/// number of errors and warnings apply to the total, so this throws a FatalError if the
+	/// errors of all parts exceed the limit.
+	void merge(ErrorList const& _errorList);
+
 	void warning(ErrorId _error, std::string const& _description);
 
 	void warning(ErrorId _error, SourceLocation const& _location, std::string const& _description);
@@ -56,6 +56,8 @@
 
 #include <boost/algorithm/string/classification.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <optional>
 #include <string_view>
 #include <tuple>
@@ -64,6 +66,34 @@ using namespace std;
 
 namespace solidity::langutil {
 
+namespace
+{
+
+/// The fast paths of the scanner examine this many bytes of the source at once.
+size_t constexpr c_wordSize = sizeof(uint64_t);
+/// Word with all bytes set to one, used to repeat a byte across a word.
+uint64_t constexpr c_bytesOfOne = 0x0101010101010101;
+
+/// @returns the word of @a _source starting at @a _position, which must be followed by at
+/// least c_wordSize bytes.
+inline uint64_t loadWord(string const& _source, size_t _position)
+{
+	uint64_t word;
+	memcpy(&word, _source.data() + _position, c_wordSize);
+	return word;
+}
+
+/// @returns true if all bytes of @a _word are ASCII characters other than control characters,
+/// i.e. none of them is or starts a line terminator.
+inline bool isPrintableASCII(uint64_t _word)
+{
+	// A byte is below 0x20 if subtracting 0x20 sets its top bit where it was not set before.
+	// The borrows this causes between bytes cannot lead to false positives.
+	return ((((_word - 0x20 * c_bytesOfOne) & ~_word) | _word) & (0x80 * c_bytesOfOne)) == 0;
+}
+
+}
+
 string to_string(ScannerError _errorCode)
 {
 	switch (_errorCode)
@@ -258,11 +288,23 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 
 bool Scanner::skipWhitespace()
 {
-	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
-		advance();
-	// Return whether or not we skipped any characters.
-	return sourcePos() != startPosition;
+	if (!isWhiteSpace(m_char))
+		return false;
+	// The current character does not have to be the one in the source, since comments are
+	// replaced by a space. Skip the indentation after it word by word and the rest of the
+	// whitespace byte by byte.
+	advance();
+	string const& source = m_source->source();
+	size_t position = sourcePos();
+	while (
+		position + c_wordSize <= source.size() &&
+		(loadWord(source, position) == ' ' * c_bytesOfOne || loadWord(source, position) == '\t' * c_bytesOfOne)
+	)
+		position += c_wordSize;
+	while (position < source.size() && isWhiteSpace(source[position]))
+		++position;
+	m_char = m_source->setPosition(position);
+	return true;
 }
 
 bool Scanner::skipWhitespaceExceptUnicodeLinebreak()
@@ -294,11 +336,17 @@ static ScannerError validateBiDiMarkup(CharStream& _stream, size_t _startPositio
 	};
 
 	size_t endPosition = _stream.position();
-	_stream.setPosition(_startPosition);
+	string const& source = _stream.source();
 
 	int directionOverrideDepth = 0;
 
-	for (size_t currentPos = _startPosition; currentPos < endPosition; ++currentPos)
+	// All directional sequences start with 0xE2, so only positions holding that byte
+	// have to be checked. This keeps the check cheap for long comments in plain ASCII.
+	for (
+		size_t currentPos = source.find('\xE2', _startPosition);
+		currentPos < endPosition;
+		currentPos = source.find('\xE2', currentPos + 1)
+	)
 	{
 		_stream.setPosition(currentPos);
 
@@ -322,9 +370,26 @@ Token Scanner::skipSingleLineComment()
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source->position();
+	string const& source = m_source->source();
 	while (!isUnicodeLinebreak())
+	{
+		// Skip ahead over characters that can neither be nor start a line terminator, first
+		// word by word over plain ASCII text and then byte by byte.
+		size_t position = m_source->position();
+		while (position + 1 + c_wordSize <= source.size() && isPrintableASCII(loadWord(source, position + 1)))
+			position += c_wordSize;
+		while (
+			position + 1 < source.size() &&
+			!(0x0a <= source[position + 1] && source[position + 1] <= 0x0d) &&
+			uint8_t(source[position + 1]) != 0xc2 &&
+			uint8_t(source[position + 1]) != 0xe2
+		)
+			++position;
+		if (position != m_source->position())
+			m_char = m_source->setPosition(position);
 		if (!advance())
 			break;
+	}
 
 	ScannerError unicodeDirectionError = validateBiDiMarkup(*m_source, startPosition);
 	if (unicodeDirectionError != ScannerError::NoError)
@@ -402,15 +467,17 @@ size_t Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	size_t startPosition = m_source->position();
-	while (!isSourcePastEndOfInput())
+	if (!isSourcePastEndOfInput())
 	{
-		char prevChar = m_char;
-		advance();
+		size_t terminator = m_source->source().find("*/", startPosition);
+		m_char = m_source->setPosition(
+			terminator == string::npos ? m_source->source().size() : terminator + 1
+		);
 
 		// If we have reached the end of the multi-line comment, we
 		// consume the '/' and insert a whitespace. This way all
 		// multi-line comments are treated as whitespace.
-		if (prevChar == '*' && m_char == '/')
+		if (terminator != string::npos)
 		{
 			ScannerError unicodeDirectionError = validateBiDiMarkup(*m_source, startPosition);
 			if (unicodeDirectionError != ScannerError::NoError)
@@ -1021,10 +1088,17 @@ tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
-	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	// Scan the rest of the identifier characters and add them to the literal in one go.
+	string const& source = m_source->source();
+	size_t const startPosition = m_source->position();
+	size_t endPosition = startPosition + 1;
+	while (
+		endPosition < source.size() &&
+		(isIdentifierPart(source[endPosition]) || (source[endPosition] == '.' && m_kind == ScannerKind::Yul))
+	)
+		++endPosition;
+	m_tokens[NextNext].literal.append(source, startPosition, endPosition - startPosition);
+	m_char = m_source->setPosition(endPosition);
 	literal.complete();
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
 	if (m_kind == ScannerKind::Yul)
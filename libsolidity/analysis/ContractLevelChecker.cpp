@@ -243,14 +243,14 @@ void ContractLevelChecker::checkAbstractDefinitions(ContractDefinition const& _c
 	{
 		for (VariableDeclaration const* v: contract->stateVariables())
 			if (v->isPartOfExternalInterface())
-				registerProxy(OverrideProxy(v));
+				registerProxy(m_overrideChecker.proxy(*v));
 
 		for (FunctionDefinition const* function: contract->definedFunctions())
 			if (!function->isConstructor())
-				registerProxy(OverrideProxy(function));
+				registerProxy(m_overrideChecker.proxy(*function));
 
 		for (ModifierDefinition const* modifier: contract->functionModifiers())
-			registerProxy(OverrideProxy(modifier));
+			registerProxy(m_overrideChecker.proxy(*modifier));
 	}
 
 	// Set to not fully implemented if at least one flag is false.
@@ -27,6 +27,8 @@
 #include <libsolidity/ast/Types.h>
 #include <libsolutil/StringUtils.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::frontend;
@@ -36,14 +38,20 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 	ASTString const* _name
 ) const
 {
-	if (!_name)
-		_name = &_declaration.name();
-	solAssert(!_name->empty(), "");
+	return conflictingDeclaration(_declaration, _name ? ASTSymbol(*_name) : _declaration.nameSymbol());
+}
+
+Declaration const* DeclarationContainer::conflictingDeclaration(
+	Declaration const& _declaration,
+	ASTSymbol _name
+) const
+{
+	solAssert(!_name.empty(), "");
 	vector<Declaration const*> declarations;
-	if (m_declarations.count(*_name))
-		declarations += m_declarations.at(*_name);
-	if (m_invisibleDeclarations.count(*_name))
-		declarations += m_invisibleDeclarations.at(*_name);
+	if (auto visible = m_declarations.find(_name); visible != m_declarations.end())
+		declarations += visible->second;
+	if (auto invisible = m_invisibleDeclarations.find(_name); invisible != m_invisibleDeclarations.end())
+		declarations += invisible->second;
 
 	if (
 		dynamic_cast<FunctionDefinition const*>(&_declaration) ||
@@ -83,18 +91,20 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 
 void DeclarationContainer::activateVariable(ASTString const& _name)
 {
+	ASTSymbol name(_name);
 	solAssert(
-		m_invisibleDeclarations.count(_name) && m_invisibleDeclarations.at(_name).size() == 1,
+		m_invisibleDeclarations.count(name) && m_invisibleDeclarations.at(name).size() == 1,
 		"Tried to activate a non-inactive variable or multiple inactive variables with the same name."
 	);
-	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
-	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
-	m_invisibleDeclarations.erase(_name);
+	solAssert(m_declarations.count(name) == 0 || m_declarations.at(name).empty(), "");
+	m_declarations[name].emplace_back(m_invisibleDeclarations.at(name).front());
+	m_invisibleDeclarations.erase(name);
+	invalidateDeclaringContainers(name);
 }
 
 bool DeclarationContainer::isInvisible(ASTString const& _name) const
 {
-	return m_invisibleDeclarations.count(_name);
+	return m_invisibleDeclarations.count(ASTSymbol(_name));
 }
 
 bool DeclarationContainer::registerDeclaration(
@@ -105,20 +115,19 @@ bool DeclarationContainer::registerDeclaration(
 	bool _update
 )
 {
-	if (!_name)
-		_name = &_declaration.name();
-	if (_name->empty())
+	ASTSymbol name = _name ? ASTSymbol(*_name) : _declaration.nameSymbol();
+	if (name.empty())
 		return true;
 
 	if (_update)
 	{
 		solAssert(!dynamic_cast<FunctionDefinition const*>(&_declaration), "Attempt to update function definition.");
-		m_declarations.erase(*_name);
-		m_invisibleDeclarations.erase(*_name);
+		m_declarations.erase(name);
+		m_invisibleDeclarations.erase(name);
 	}
 	else
 	{
-		if (conflictingDeclaration(_declaration, _name))
+		if (conflictingDeclaration(_declaration, name))
 			return false;
 
 		// Do not warn about shadowing for structs and enums because their members are
@@ -126,12 +135,14 @@ bool DeclarationContainer::registerDeclaration(
 		// because they do not participate in any proper scope.
 		bool special = _declaration.scope() && (_declaration.isStructMember() || _declaration.isEnumValue() || _declaration.isEventOrErrorParameter());
 		if (m_enclosingContainer && !special)
-			m_homonymCandidates.emplace_back(*_name, _location ? _location : &_declaration.location());
+			m_homonymCandidates.emplace_back(name, _location ? _location : &_declaration.location());
 	}
 
-	vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[*_name] : m_declarations[*_name];
+	vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[name] : m_declarations[name];
 	if (!util::contains(decls, &_declaration))
 		decls.push_back(&_declaration);
+	if (!_invisible)
+		invalidateDeclaringContainers(name);
 	return true;
 }
 
@@ -145,18 +156,79 @@ bool DeclarationContainer::registerDeclaration(
 }
 
 vector<Declaration const*> DeclarationContainer::resolveName(ASTString const& _name, bool _recursive, bool _alsoInvisible) const
+{
+	return resolveName(ASTSymbol(_name), _recursive, _alsoInvisible);
+}
+
+vector<Declaration const*> DeclarationContainer::resolveName(ASTSymbol _name, bool _recursive, bool _alsoInvisible) const
 {
 	solAssert(!_name.empty(), "Attempt to resolve empty name.");
+	if (_recursive && !_alsoInvisible)
+	{
+		if (DeclarationContainer const* container = declaringContainer(_name))
+			return container->m_declarations.at(_name);
+		return {};
+	}
+
 	vector<Declaration const*> result;
-	if (m_declarations.count(_name))
-		result = m_declarations.at(_name);
-	if (_alsoInvisible && m_invisibleDeclarations.count(_name))
-		result += m_invisibleDeclarations.at(_name);
+	if (auto visible = m_declarations.find(_name); visible != m_declarations.end())
+		result = visible->second;
+	if (_alsoInvisible)
+		if (auto invisible = m_invisibleDeclarations.find(_name); invisible != m_invisibleDeclarations.end())
+			result += invisible->second;
 	if (result.empty() && _recursive && m_enclosingContainer)
 		result = m_enclosingContainer->resolveName(_name, true, _alsoInvisible);
 	return result;
 }
 
+DeclarationContainer const* DeclarationContainer::declaringContainer(ASTSymbol _name) const
+{
+	if (declaresVisible(_name))
+		return this;
+	if (!m_enclosingContainer)
+		return nullptr;
+
+	// Declarations can be removed from the cached container, e.g. when "this" and "super" are
+	// updated, so it has to be checked.
+	auto cached = m_declaringContainers.find(_name);
+	if (cached != m_declaringContainers.end() && cached->second->declaresVisible(_name))
+		return cached->second;
+
+	DeclarationContainer const* container = m_enclosingContainer->declaringContainer(_name);
+	if (!container)
+	{
+		if (cached != m_declaringContainers.end())
+			m_declaringContainers.erase(cached);
+		return nullptr;
+	}
+	m_declaringContainers[_name] = container;
+	for (
+		DeclarationContainer const* enclosing = this;
+		enclosing && !enclosing->m_hasCachedLookups;
+		enclosing = enclosing->m_enclosingContainer
+	)
+		enclosing->m_hasCachedLookups = true;
+	return container;
+}
+
+void DeclarationContainer::invalidateDeclaringContainers(ASTSymbol _name) const
+{
+	// Names declared in the outermost container are found last, so that they cannot hide the
+	// results of cached lookups. This avoids visiting all containers whenever "this" and "super"
+	// are updated.
+	if (!m_hasCachedLookups || !m_enclosingContainer)
+		return;
+	m_declaringContainers.erase(_name);
+	for (DeclarationContainer const* innerContainer: m_innerContainers)
+		innerContainer->invalidateDeclaringContainers(_name);
+}
+
+bool DeclarationContainer::declaresVisible(ASTSymbol _name) const
+{
+	auto declarations = m_declarations.find(_name);
+	return declarations != m_declarations.end() && !declarations->second.empty();
+}
+
 vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) const
 {
 
@@ -168,16 +240,19 @@ vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) con
 	size_t maximumEditDistance = _name.size() > 3 ? 2 : _name.size() / 2;
 	for (auto const& declaration: m_declarations)
 	{
-		string const& declarationName = declaration.first;
+		string const& declarationName = declaration.first.str();
 		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
 			similar.push_back(declarationName);
 	}
+	// The hash table is not ordered, but the suggestions should not depend on its order.
+	size_t start = similar.size();
 	for (auto const& declaration: m_invisibleDeclarations)
 	{
-		string const& declarationName = declaration.first;
+		string const& declarationName = declaration.first.str();
 		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
 			similar.push_back(declarationName);
 	}
+	sort(similar.begin() + static_cast<ptrdiff_t>(start), similar.end());
 
 	if (m_enclosingContainer)
 		similar += m_enclosingContainer->similarNames(_name);
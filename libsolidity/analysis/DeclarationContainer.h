@@ -27,12 +27,20 @@
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 namespace solidity::frontend
 {
 
 /**
  * Container that stores mappings between names and declarations. It also contains a link to the
- * enclosing scope.
+ * enclosing scope. Declarations are keyed by the interned names. The visible ones are kept
+ * ordered by name, since they are iterated in that order when scopes are imported.
+ *
+ * Recursive lookups remember in which enclosing container a name was found, so that the chain of
+ * enclosing containers is only searched once per name and container.
  */
 class DeclarationContainer
 {
@@ -58,9 +66,11 @@ public:
 	bool registerDeclaration(Declaration const& _declaration, bool _invisible, bool _update);
 
 	std::vector<Declaration const*> resolveName(ASTString const& _name, bool _recursive = false, bool _alsoInvisible = false) const;
+	std::vector<Declaration const*> resolveName(ASTSymbol _name, bool _recursive = false, bool _alsoInvisible = false) const;
 	ASTNode const* enclosingNode() const { return m_enclosingNode; }
 	DeclarationContainer const* enclosingContainer() const { return m_enclosingContainer; }
-	std::map<ASTString, std::vector<Declaration const*>> const& declarations() const { return m_declarations; }
+	/// @returns the visible declarations ordered by name.
+	std::map<ASTSymbol, std::vector<Declaration const*>> const& declarations() const { return m_declarations; }
 	/// @returns whether declaration is valid, and if not also returns previous declaration.
 	Declaration const* conflictingDeclaration(Declaration const& _declaration, ASTString const* _name = nullptr) const;
 
@@ -80,13 +90,27 @@ public:
 	void populateHomonyms(std::back_insert_iterator<Homonyms> _it) const;
 
 private:
+	Declaration const* conflictingDeclaration(Declaration const& _declaration, ASTSymbol _name) const;
+	/// @returns the closest container along the chain of enclosing containers, starting with
+	/// this one, that has visible declarations of @a _name, or nullptr if there is none.
+	DeclarationContainer const* declaringContainer(ASTSymbol _name) const;
+	/// Removes the cached lookups of @a _name from this container and the containers inside it.
+	/// Has to be called when declarations of @a _name become visible in this container.
+	void invalidateDeclaringContainers(ASTSymbol _name) const;
+	/// @returns true if this container has visible declarations of @a _name.
+	bool declaresVisible(ASTSymbol _name) const;
+
 	ASTNode const* m_enclosingNode;
 	DeclarationContainer const* m_enclosingContainer;
 	std::vector<DeclarationContainer const*> m_innerContainers;
-	std::map<ASTString, std::vector<Declaration const*>> m_declarations;
-	std::map<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
+	std::map<ASTSymbol, std::vector<Declaration const*>> m_declarations;
+	std::unordered_map<ASTSymbol, std::vector<Declaration const*>> m_invisibleDeclarations;
 	/// List of declarations (name and location) to check later for homonymity.
-	std::vector<std::pair<std::string, langutil::SourceLocation const*>> m_homonymCandidates;
+	std::vector<std::pair<ASTSymbol, langutil::SourceLocation const*>> m_homonymCandidates;
+	/// Cached results of @a declaringContainer for names that are not declared in this container.
+	mutable std::unordered_map<ASTSymbol, DeclarationContainer const*> m_declaringContainers;
+	/// False if neither this container nor any container inside it has cached lookups.
+	mutable bool m_hasCachedLookups = false;
 };
 
 }
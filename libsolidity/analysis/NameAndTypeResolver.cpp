@@ -110,11 +110,14 @@ bool NameAndTypeResolver::performImports(SourceUnit& _sourceUnit, map<string, So
 				for (auto const& nameAndDeclaration: scope->second->declarations())
 					for (auto const& declaration: nameAndDeclaration.second)
 						if (!DeclarationRegistrationHelper::registerDeclaration(
-							target, *declaration, &nameAndDeclaration.first, &imp->location(), false, m_errorReporter
+							target, *declaration, &nameAndDeclaration.first.str(), &imp->location(), false, m_errorReporter
 						))
 							error =  true;
 		}
-	_sourceUnit.annotation().exportedSymbols = m_scopes[&_sourceUnit]->declarations();
+	map<ASTString, vector<Declaration const*>> exportedSymbols;
+	for (auto const& [name, nameDeclarations]: m_scopes[&_sourceUnit]->declarations())
+		exportedSymbols.emplace_hint(exportedSymbols.end(), name.str(), nameDeclarations);
+	_sourceUnit.annotation().exportedSymbols = std::move(exportedSymbols);
 	return !error;
 }
 
@@ -179,6 +182,11 @@ vector<Declaration const*> NameAndTypeResolver::nameFromCurrentScope(ASTString c
 	return m_currentScope->resolveName(_name, true, _includeInvisibles);
 }
 
+vector<Declaration const*> NameAndTypeResolver::nameFromCurrentScope(ASTSymbol _name, bool _includeInvisibles) const
+{
+	return m_currentScope->resolveName(_name, true, _includeInvisibles);
+}
+
 Declaration const* NameAndTypeResolver::pathFromCurrentScope(vector<ASTString> const& _path) const
 {
 	solAssert(!_path.empty(), "");
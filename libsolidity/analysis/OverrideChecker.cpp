@@ -37,22 +37,11 @@ using namespace solidity::frontend;
 using namespace solidity::langutil;
 
 using solidity::util::GenericVisitor;
-using solidity::util::contains_if;
 using solidity::util::joinHumanReadable;
 
 namespace
 {
 
-// Helper struct to do a search by name
-struct MatchByName
-{
-	string const& m_name;
-	bool operator()(OverrideProxy const& _item)
-	{
-		return _item.name() == m_name;
-	}
-};
-
 /**
  * Construct the override graph for this signature.
  * Reserve node 0 for the current contract and node
@@ -417,7 +406,8 @@ OverrideProxy::OverrideComparator const& OverrideProxy::overrideComparator() con
 				return OverrideComparator{
 					_function->name(),
 					_function->kind(),
-					std::move(paramTypes)
+					std::move(paramTypes),
+					{}
 				};
 			},
 			[&](VariableDeclaration const* _var)
@@ -428,7 +418,8 @@ OverrideProxy::OverrideComparator const& OverrideProxy::overrideComparator() con
 				return OverrideComparator{
 					_var->name(),
 					Token::Function,
-					std::move(paramTypes)
+					std::move(paramTypes),
+					{}
 				};
 			},
 			[&](ModifierDefinition const* _mod)
@@ -436,10 +427,20 @@ OverrideProxy::OverrideComparator const& OverrideProxy::overrideComparator() con
 				return OverrideComparator{
 					_mod->name(),
 					{},
+					{},
 					{}
 				};
 			}
 		}, m_item));
+
+		OverrideComparator& comparator = *m_comparator;
+		if (!comparator.functionKind)
+			comparator.signature = comparator.name;
+		else if (*comparator.functionKind != Token::Function)
+			// Parameters do not matter for non-regular functions.
+			comparator.signature = string(TokenTraits::toString(*comparator.functionKind)) + " " + comparator.name;
+		else
+			comparator.signature = comparator.name + "(" + joinHumanReadable(*comparator.parameterTypes, ",") + ")";
 	}
 
 	return *m_comparator;
@@ -461,19 +462,19 @@ void OverrideChecker::check(ContractDefinition const& _contract)
 
 void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 {
-	OverrideProxyBySignatureMultiSet const& inheritedFuncs = inheritedFunctions(_contract);
-	OverrideProxyBySignatureMultiSet const& inheritedMods = inheritedModifiers(_contract);
+	InheritedCallables const& inheritedFuncs = inheritedFunctions(_contract);
+	InheritedCallables const& inheritedMods = inheritedModifiers(_contract);
 
 	for (ModifierDefinition const* modifier: _contract.functionModifiers())
 	{
-		if (contains_if(inheritedFuncs, MatchByName{modifier->name()}))
+		if (inheritedFuncs.names.count(modifier->name()))
 			m_errorReporter.typeError(
 				5631_error,
 				modifier->location(),
 				"Override changes function or public state variable to modifier."
 			);
 
-		checkOverrideList(OverrideProxy{modifier}, inheritedMods);
+		checkOverrideList(proxy(*modifier), inheritedMods);
 	}
 
 	for (FunctionDefinition const* function: _contract.definedFunctions())
@@ -481,10 +482,10 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 		if (function->isConstructor())
 			continue;
 
-		if (contains_if(inheritedMods, MatchByName{function->name()}))
+		if (inheritedMods.names.count(function->name()))
 			m_errorReporter.typeError(1469_error, function->location(), "Override changes modifier to function.");
 
-		checkOverrideList(OverrideProxy{function}, inheritedFuncs);
+		checkOverrideList(proxy(*function), inheritedFuncs);
 	}
 	for (auto const* stateVar: _contract.stateVariables())
 	{
@@ -496,10 +497,10 @@ void OverrideChecker::checkIllegalOverrides(ContractDefinition const& _contract)
 			continue;
 		}
 
-		if (contains_if(inheritedMods, MatchByName{stateVar->name()}))
+		if (inheritedMods.names.count(stateVar->name()))
 			m_errorReporter.typeError(1456_error, stateVar->location(), "Override changes modifier to public state variable.");
 
-		checkOverrideList(OverrideProxy{stateVar}, inheritedFuncs);
+		checkOverrideList(proxy(*stateVar), inheritedFuncs);
 	}
 
 }
@@ -679,44 +680,46 @@ void OverrideChecker::overrideError(OverrideProxy const& _overriding, OverridePr
 
 void OverrideChecker::checkAmbiguousOverrides(ContractDefinition const& _contract) const
 {
+	// Inherited functions or modifiers with the same signature that are not overridden in the
+	// current contract, ordered by signature so that errors are reported in a stable order.
+	vector<set<OverrideProxy>> candidates;
+	auto collectCandidates = [&](InheritedCallables const& _inherited, unordered_set<string> const& _overridden)
 	{
-		// Fetch inherited functions and sort them by signature.
-		// We get at least one function per signature and direct base contract, which is
+		// We get at least one item per signature and direct base contract, which is
 		// enough because we re-construct the inheritance graph later.
-		OverrideProxyBySignatureMultiSet nonOverriddenFunctions = inheritedFunctions(_contract);
+		for (auto const& [signature, baseCallables]: _inherited.bySignature)
+			if (baseCallables.size() > 1 && !_overridden.count(signature))
+			{
+				set<OverrideProxy> callables(baseCallables.begin(), baseCallables.end());
+				if (callables.size() > 1)
+					candidates.emplace_back(std::move(callables));
+			}
+		sort(candidates.begin(), candidates.end(), [](set<OverrideProxy> const& _a, set<OverrideProxy> const& _b) {
+			return OverrideProxy::CompareBySignature{}(*_a.begin(), *_b.begin());
+		});
+		for (set<OverrideProxy>& callables: candidates)
+			checkAmbiguousOverridesInternal(std::move(callables), _contract.location());
+		candidates.clear();
+	};
 
-		// Remove all functions that match the signature of a function in the current contract.
+	{
+		// Skip all functions that match the signature of a function in the current contract.
+		unordered_set<string> overridden;
 		for (FunctionDefinition const* f: _contract.definedFunctions())
-			nonOverriddenFunctions.erase(OverrideProxy{f});
+			overridden.insert(proxy(*f).signature());
 		for (VariableDeclaration const* v: _contract.stateVariables())
 			if (v->isPublic())
-				nonOverriddenFunctions.erase(OverrideProxy{v});
-
-		// Walk through the set of functions signature by signature.
-		for (auto it = nonOverriddenFunctions.cbegin(); it != nonOverriddenFunctions.cend();)
-		{
-			std::set<OverrideProxy> baseFunctions;
-			for (auto nextSignature = nonOverriddenFunctions.upper_bound(*it); it != nextSignature; ++it)
-				baseFunctions.insert(*it);
+				overridden.insert(proxy(*v).signature());
 
-			checkAmbiguousOverridesInternal(std::move(baseFunctions), _contract.location());
-		}
+		collectCandidates(inheritedFunctions(_contract), overridden);
 	}
 
 	{
-		OverrideProxyBySignatureMultiSet modifiers = inheritedModifiers(_contract);
+		unordered_set<string> overridden;
 		for (ModifierDefinition const* mod: _contract.functionModifiers())
-			modifiers.erase(OverrideProxy{mod});
-
-		for (auto it = modifiers.cbegin(); it != modifiers.cend();)
-		{
-			std::set<OverrideProxy> baseModifiers;
-			for (auto next = modifiers.upper_bound(*it); it != next; ++it)
-				baseModifiers.insert(*it);
-
-			checkAmbiguousOverridesInternal(std::move(baseModifiers), _contract.location());
-		}
+			overridden.insert(proxy(*mod).signature());
 
+		collectCandidates(inheritedModifiers(_contract), overridden);
 	}
 }
 
@@ -794,7 +797,7 @@ set<ContractDefinition const*, OverrideChecker::CompareByID> OverrideChecker::re
 	return resolved;
 }
 
-void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureMultiSet const& _inherited)
+void OverrideChecker::checkOverrideList(OverrideProxy _item, InheritedCallables const& _inherited)
 {
 	set<ContractDefinition const*, CompareByID> specifiedContracts =
 		_item.overrides() ?
@@ -837,13 +840,14 @@ void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySign
 	set<ContractDefinition const*, CompareByID> expectedContracts;
 
 	// Build list of expected contracts
-	for (auto [begin, end] = _inherited.equal_range(_item); begin != end; begin++)
-	{
-		// Validate the override
-		checkOverride(_item, *begin);
+	if (auto it = _inherited.bySignature.find(_item.signature()); it != _inherited.bySignature.end())
+		for (OverrideProxy const& super: it->second)
+		{
+			// Validate the override
+			checkOverride(_item, super);
 
-		expectedContracts.insert(&begin->contract());
-	}
+			expectedContracts.insert(&super.contract());
+		}
 
 	if (_item.overrides() && expectedContracts.empty())
 		m_errorReporter.typeError(
@@ -877,54 +881,96 @@ void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySign
 		);
 }
 
-OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedFunctions(ContractDefinition const& _contract) const
+OverrideChecker::InheritedCallables const& OverrideChecker::inheritedFunctions(ContractDefinition const& _contract) const
 {
 	if (!m_inheritedFunctions.count(&_contract))
 	{
-		OverrideProxyBySignatureMultiSet result;
+		InheritedCallables result;
 
 		for (auto const* base: resolveDirectBaseContracts(_contract))
 		{
-			set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
+			vector<OverrideProxy> functionsInBase;
 			for (FunctionDefinition const* fun: base->definedFunctions())
 				if (!fun->isConstructor())
-					functionsInBase.emplace(OverrideProxy{fun});
+					functionsInBase.emplace_back(proxy(*fun));
 			for (VariableDeclaration const* var: base->stateVariables())
 				if (var->isPublic())
-					functionsInBase.emplace(OverrideProxy{var});
-
-			for (OverrideProxy const& func: inheritedFunctions(*base))
-				functionsInBase.insert(func);
+					functionsInBase.emplace_back(proxy(*var));
 
-			result += functionsInBase;
+			addBaseCallables(result, functionsInBase, inheritedFunctions(*base));
 		}
 
-		m_inheritedFunctions[&_contract] = result;
+		m_inheritedFunctions[&_contract] = std::move(result);
 	}
 
 	return m_inheritedFunctions[&_contract];
 }
 
-OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedModifiers(ContractDefinition const& _contract) const
+OverrideChecker::InheritedCallables const& OverrideChecker::inheritedModifiers(ContractDefinition const& _contract) const
 {
 	if (!m_inheritedModifiers.count(&_contract))
 	{
-		OverrideProxyBySignatureMultiSet result;
+		InheritedCallables result;
 
 		for (auto const* base: resolveDirectBaseContracts(_contract))
 		{
-			set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
+			vector<OverrideProxy> modifiersInBase;
 			for (ModifierDefinition const* mod: base->functionModifiers())
-				modifiersInBase.emplace(OverrideProxy{mod});
-
-			for (OverrideProxy const& mod: inheritedModifiers(*base))
-				modifiersInBase.insert(mod);
+				modifiersInBase.emplace_back(proxy(*mod));
 
-			result += modifiersInBase;
+			addBaseCallables(result, modifiersInBase, inheritedModifiers(*base));
 		}
 
-		m_inheritedModifiers[&_contract] = result;
+		m_inheritedModifiers[&_contract] = std::move(result);
 	}
 
 	return m_inheritedModifiers[&_contract];
 }
+
+template <class T>
+OverrideProxy const& OverrideChecker::cachedProxy(T const& _item) const
+{
+	auto it = m_proxies.find(&_item);
+	if (it == m_proxies.end())
+		it = m_proxies.emplace(&_item, OverrideProxy{&_item}).first;
+	return it->second;
+}
+
+OverrideProxy const& OverrideChecker::proxy(FunctionDefinition const& _function) const
+{
+	return cachedProxy(_function);
+}
+
+OverrideProxy const& OverrideChecker::proxy(ModifierDefinition const& _modifier) const
+{
+	return cachedProxy(_modifier);
+}
+
+OverrideProxy const& OverrideChecker::proxy(VariableDeclaration const& _variable) const
+{
+	return cachedProxy(_variable);
+}
+
+void OverrideChecker::addBaseCallables(
+	InheritedCallables& _index,
+	vector<OverrideProxy> const& _callables,
+	InheritedCallables const& _inheritedCallables
+) const
+{
+	// Only the first item of each signature is taken from the base, i.e. the
+	// items defined in the base hide the ones inherited by the base.
+	unordered_set<string> signaturesInBase;
+	for (OverrideProxy const& callable: _callables)
+		if (signaturesInBase.insert(callable.signature()).second)
+		{
+			_index.bySignature[callable.signature()].emplace_back(callable);
+			_index.names.insert(callable.name());
+		}
+	for (auto const& [signature, callables]: _inheritedCallables.bySignature)
+		if (!signaturesInBase.count(signature))
+		{
+			solAssert(!callables.empty(), "");
+			_index.bySignature[signature].emplace_back(callables.front());
+			_index.names.insert(callables.front().name());
+		}
+}
@@ -27,6 +27,8 @@
 #include <map>
 #include <functional>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <optional>
 
@@ -108,6 +110,10 @@ public:
 		std::string name;
 		std::optional<langutil::Token> functionKind;
 		std::optional<std::vector<std::string>> parameterTypes;
+		/// Name, kind and, for regular functions, parameter types in a single string.
+		/// Two functions (or two modifiers) override each other if and only if their
+		/// signatures are equal.
+		std::string signature;
 
 		bool operator<(OverrideComparator const& _other) const;
 	};
@@ -115,6 +121,8 @@ public:
 	/// @returns a structure used to compare override items with regards to whether
 	/// they override each other.
 	OverrideComparator const& overrideComparator() const;
+	/// @returns the signature of the override comparator, used to index override items.
+	std::string const& signature() const { return overrideComparator().signature; }
 
 private:
 	std::variant<
@@ -133,7 +141,18 @@ private:
 class OverrideChecker
 {
 public:
-	using OverrideProxyBySignatureMultiSet = std::multiset<OverrideProxy, OverrideProxy::CompareBySignature>;
+	/**
+	 * Functions and public state variables, or modifiers, of the bases of a contract that have
+	 * not been overridden inside the bases, indexed by their signature.
+	 */
+	struct InheritedCallables
+	{
+		/// For each signature, at most one item per direct base, in the order of the direct bases.
+		/// May contain the same item multiple times when used with shared bases.
+		std::unordered_map<std::string, std::vector<OverrideProxy>> bySignature;
+		/// Names of all the items.
+		std::unordered_set<std::string> names;
+	};
 
 	/// @param _errorReporter provides the error logging functionality.
 	explicit OverrideChecker(langutil::ErrorReporter& _errorReporter):
@@ -148,9 +167,15 @@ public:
 	};
 
 	/// Returns all functions of bases (including public state variables) that have not yet been overwritten.
-	/// May contain the same function multiple times when used with shared bases.
-	OverrideProxyBySignatureMultiSet const& inheritedFunctions(ContractDefinition const& _contract) const;
-	OverrideProxyBySignatureMultiSet const& inheritedModifiers(ContractDefinition const& _contract) const;
+	/// The index is built once per contract from the indices of the direct bases.
+	InheritedCallables const& inheritedFunctions(ContractDefinition const& _contract) const;
+	InheritedCallables const& inheritedModifiers(ContractDefinition const& _contract) const;
+
+	/// @returns the override proxy of the given item. The proxy is only created once per item,
+	/// so that its signature is only computed once, no matter in how many contracts it is used.
+	OverrideProxy const& proxy(FunctionDefinition const& _function) const;
+	OverrideProxy const& proxy(ModifierDefinition const& _modifier) const;
+	OverrideProxy const& proxy(VariableDeclaration const& _variable) const;
 
 private:
 	void checkIllegalOverrides(ContractDefinition const& _contract);
@@ -187,13 +212,24 @@ private:
 	/// Resolves an override list of UserDefinedTypeNames to a list of contracts.
 	std::set<ContractDefinition const*, CompareByID> resolveOverrideList(OverrideSpecifier const& _overrides) const;
 
-	void checkOverrideList(OverrideProxy _item, OverrideProxyBySignatureMultiSet const& _inherited);
+	void checkOverrideList(OverrideProxy _item, InheritedCallables const& _inherited);
+	/// Adds the callables of @a _base that are not overridden, i.e. its own @a _callables
+	/// followed by @a _inheritedCallables, to @a _index.
+	void addBaseCallables(
+		InheritedCallables& _index,
+		std::vector<OverrideProxy> const& _callables,
+		InheritedCallables const& _inheritedCallables
+	) const;
+	template <class T>
+	OverrideProxy const& cachedProxy(T const& _item) const;
 
 	langutil::ErrorReporter& m_errorReporter;
 
 	/// Cache for inheritedFunctions().
-	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedFunctions;
-	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedModifiers;
+	std::map<ContractDefinition const*, InheritedCallables> mutable m_inheritedFunctions;
+	std::map<ContractDefinition const*, InheritedCallables> mutable m_inheritedModifiers;
+	/// Cache for proxy().
+	std::unordered_map<Declaration const*, OverrideProxy> mutable m_proxies;
 };
 
 }
@@ -118,7 +118,7 @@ bool ReferencesResolver::visit(VariableDeclaration const& _varDecl)
 
 bool ReferencesResolver::visit(Identifier const& _identifier)
 {
-	auto declarations = m_resolver.nameFromCurrentScope(_identifier.name());
+	auto declarations = m_resolver.nameFromCurrentScope(_identifier.nameSymbol());
 	if (declarations.empty())
 	{
 		string suggestions = m_resolver.similarNameSuggestions(_identifier.name());
@@ -2708,15 +2708,16 @@ bool TypeChecker::visit(MemberAccess const& _memberAccess)
 
 	// Retrieve the types of the arguments if this is used to call a function.
 	auto const& arguments = annotation.arguments;
-	MemberList::MemberMap possibleMembers = exprType->members(currentDefinitionScope()).membersByName(memberName);
+	vector<MemberList::Member const*> possibleMembers =
+		exprType->members(currentDefinitionScope()).membersByName(_memberAccess.memberNameSymbol());
 	size_t const initialMemberCount = possibleMembers.size();
 	if (initialMemberCount > 1 && arguments)
 	{
 		// do overload resolution
 		for (auto it = possibleMembers.begin(); it != possibleMembers.end();)
 			if (
-				it->type->category() == Type::Category::Function &&
-				!dynamic_cast<FunctionType const&>(*it->type).canTakeArguments(*arguments, exprType)
+				(*it)->type->category() == Type::Category::Function &&
+				!dynamic_cast<FunctionType const&>(*(*it)->type).canTakeArguments(*arguments, exprType)
 			)
 				it = possibleMembers.erase(it);
 			else
@@ -2734,7 +2735,7 @@ bool TypeChecker::visit(MemberAccess const& _memberAccess)
 				DataLocation::Storage,
 				exprType
 			);
-			if (!storageType->members(currentDefinitionScope()).membersByName(memberName).empty())
+			if (!storageType->members(currentDefinitionScope()).membersByName(_memberAccess.memberNameSymbol()).empty())
 				m_errorReporter.fatalTypeError(
 					4994_error,
 					_memberAccess.location(),
@@ -2818,8 +2819,8 @@ bool TypeChecker::visit(MemberAccess const& _memberAccess)
 			(memberName == "value" ? " - did you forget the \"payable\" modifier?" : ".")
 		);
 
-	annotation.referencedDeclaration = possibleMembers.front().declaration;
-	annotation.type = possibleMembers.front().type;
+	annotation.referencedDeclaration = possibleMembers.front()->declaration;
+	annotation.type = possibleMembers.front()->type;
 
 	VirtualLookup requiredLookup = VirtualLookup::Static;
 
@@ -33,6 +33,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <unordered_set>
 #include <utility>
 
 using namespace std;
@@ -102,20 +103,23 @@ bool ContractDefinition::derivesFrom(ContractDefinition const& _base) const
 	return util::contains(annotation().linearizedBaseContracts, &_base);
 }
 
-map<util::FixedHash<4>, FunctionTypePointer> ContractDefinition::interfaceFunctions(bool _includeInheritedFunctions) const
+map<util::FixedHash<4>, FunctionTypePointer> const& ContractDefinition::interfaceFunctions(bool _includeInheritedFunctions) const
 {
-	auto exportedFunctionList = interfaceFunctionList(_includeInheritedFunctions);
+	return m_interfaceFunctions[_includeInheritedFunctions].init([&]{
+		auto const& exportedFunctionList = interfaceFunctionList(_includeInheritedFunctions);
 
-	map<util::FixedHash<4>, FunctionTypePointer> exportedFunctions;
-	for (auto const& it: exportedFunctionList)
-		exportedFunctions.insert(it);
+		map<util::FixedHash<4>, FunctionTypePointer> exportedFunctions(
+			exportedFunctionList.begin(),
+			exportedFunctionList.end()
+		);
 
-	solAssert(
-		exportedFunctionList.size() == exportedFunctions.size(),
-		"Hash collision at Function Definition Hash calculation"
-	);
+		solAssert(
+			exportedFunctionList.size() == exportedFunctions.size(),
+			"Hash collision at Function Definition Hash calculation"
+		);
 
-	return exportedFunctions;
+		return exportedFunctions;
+	});
 }
 
 FunctionDefinition const* ContractDefinition::constructor() const
@@ -194,8 +198,8 @@ vector<ErrorDefinition const*> ContractDefinition::interfaceErrors(bool _require
 vector<pair<util::FixedHash<4>, FunctionTypePointer>> const& ContractDefinition::interfaceFunctionList(bool _includeInheritedFunctions) const
 {
 	return m_interfaceFunctionList[_includeInheritedFunctions].init([&]{
-		set<string> signaturesSeen;
-		vector<pair<util::FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
+		unordered_set<string> signaturesSeen;
+		vector<FunctionTypePointer> interfaceFunctionTypes;
 
 		for (ContractDefinition const* contract: annotation().linearizedBaseContracts)
 		{
@@ -213,16 +217,17 @@ vector<pair<util::FixedHash<4>, FunctionTypePointer>> const& ContractDefinition:
 				if (!fun->interfaceFunctionType())
 					// Fails hopefully because we already registered the error
 					continue;
-				string functionSignature = fun->externalSignature();
-				if (signaturesSeen.count(functionSignature) == 0)
-				{
-					signaturesSeen.insert(functionSignature);
-					util::FixedHash<4> hash(util::keccak256(functionSignature));
-					interfaceFunctionList.emplace_back(hash, fun);
-				}
+				if (signaturesSeen.insert(fun->externalSignature()).second)
+					interfaceFunctionTypes.push_back(fun);
 			}
 		}
 
+		// The selectors are only computed for the functions that end up in the list. They are
+		// cached in the function types, so that users of the list do not hash the signatures again.
+		vector<pair<util::FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
+		interfaceFunctionList.reserve(interfaceFunctionTypes.size());
+		for (FunctionTypePointer fun: interfaceFunctionTypes)
+			interfaceFunctionList.emplace_back(fun->externalSelector(), fun);
 		return interfaceFunctionList;
 	});
 }
@@ -116,7 +116,8 @@ public:
 	///@}
 
 protected:
-	size_t const m_id = 0;
+	/// Only modified by the parser when it renumbers the nodes of a source unit.
+	size_t m_id = 0;
 
 	template <class T>
 	T& initAnnotation() const
@@ -127,6 +128,8 @@ protected:
 	}
 
 private:
+	friend class Parser;
+
 	/// Annotation - is specialised in derived classes, is created upon request (because of polymorphism).
 	mutable std::unique_ptr<ASTAnnotation> m_annotation;
 	SourceLocation m_location;
@@ -237,10 +240,11 @@ public:
 		SourceLocation _nameLocation,
 		Visibility _visibility = Visibility::Default
 	):
-		ASTNode(_id, _location), m_name(std::move(_name)), m_nameLocation(std::move(_nameLocation)), m_visibility(_visibility) {}
+		ASTNode(_id, _location), m_name(*_name), m_nameLocation(std::move(_nameLocation)), m_visibility(_visibility) {}
 
 	/// @returns the declared name.
-	ASTString const& name() const { return *m_name; }
+	ASTString const& name() const { return m_name.str(); }
+	ASTSymbol nameSymbol() const { return m_name; }
 	SourceLocation const& nameLocation() const noexcept { return m_nameLocation; }
 	bool noVisibilitySpecified() const { return m_visibility == Visibility::Default; }
 	Visibility visibility() const { return m_visibility == Visibility::Default ? defaultVisibility() : m_visibility; }
@@ -278,7 +282,7 @@ protected:
 	virtual Visibility defaultVisibility() const { return Visibility::Public; }
 
 private:
-	ASTPointer<ASTString> m_name;
+	ASTSymbol m_name;
 	SourceLocation m_nameLocation;
 	Visibility m_visibility;
 };
@@ -511,7 +515,7 @@ public:
 
 	/// @returns a map of canonical function signatures to FunctionDefinitions
 	/// as intended for use by the ABI.
-	std::map<util::FixedHash<4>, FunctionTypePointer> interfaceFunctions(bool _includeInheritedFunctions = true) const;
+	std::map<util::FixedHash<4>, FunctionTypePointer> const& interfaceFunctions(bool _includeInheritedFunctions = true) const;
 	std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> const& interfaceFunctionList(bool _includeInheritedFunctions = true) const;
 	/// @returns the EIP-165 compatible interface identifier. This will exclude inherited functions.
 	uint32_t interfaceId() const;
@@ -551,6 +555,7 @@ private:
 	ContractKind m_contractKind;
 	bool m_abstract{false};
 
+	util::LazyInit<std::map<util::FixedHash<4>, FunctionTypePointer>> m_interfaceFunctions[2];
 	util::LazyInit<std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>>> m_interfaceFunctionList[2];
 	util::LazyInit<std::vector<EventDefinition const*>> m_interfaceEvents;
 };
@@ -2091,17 +2096,18 @@ public:
 		ASTPointer<Expression> _expression,
 		ASTPointer<ASTString> _memberName
 	):
-		Expression(_id, _location), m_expression(std::move(_expression)), m_memberName(std::move(_memberName)) {}
+		Expression(_id, _location), m_expression(std::move(_expression)), m_memberName(*_memberName) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 	Expression const& expression() const { return *m_expression; }
-	ASTString const& memberName() const { return *m_memberName; }
+	ASTString const& memberName() const { return m_memberName.str(); }
+	ASTSymbol memberNameSymbol() const { return m_memberName; }
 
 	MemberAccessAnnotation& annotation() const override;
 
 private:
 	ASTPointer<Expression> m_expression;
-	ASTPointer<ASTString> m_memberName;
+	ASTSymbol m_memberName;
 };
 
 /**
@@ -2176,16 +2182,17 @@ public:
 		SourceLocation const& _location,
 		ASTPointer<ASTString> _name
 	):
-		PrimaryExpression(_id, _location), m_name(std::move(_name)) {}
+		PrimaryExpression(_id, _location), m_name(*_name) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
 
-	ASTString const& name() const { return *m_name; }
+	ASTString const& name() const { return m_name.str(); }
+	ASTSymbol nameSymbol() const { return m_name; }
 
 	IdentifierAnnotation& annotation() const override;
 
 private:
-	ASTPointer<ASTString> m_name;
+	ASTSymbol m_name;
 };
 
 /**
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <libsolidity/ast/ASTSymbol.h>
+
 #include <memory>
 #include <string>
 #include <vector>
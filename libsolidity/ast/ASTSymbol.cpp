@@ -0,0 +1,82 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/ast/ASTSymbol.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+
+namespace
+{
+/// Number of independently locked parts of the table, so that parsers running in parallel
+/// rarely wait for each other.
+size_t constexpr c_shardCount = 64;
+}
+
+struct ASTSymbol::Table
+{
+	struct Shard
+	{
+		// The keys point into the entries, which never move.
+		unordered_map<string_view, unique_ptr<Entry const>> entries;
+		mutex entriesMutex;
+	};
+	/// Every name is stored in the shard selected by its hash.
+	array<Shard, c_shardCount> shards;
+};
+
+ASTSymbol::Entry const ASTSymbol::s_emptyEntry{string{}, std::hash<string_view>{}(string_view{})};
+
+ASTSymbol::ASTSymbol(string_view _name): m_entry(&s_emptyEntry)
+{
+	if (_name.empty())
+		return;
+
+	size_t nameHash = std::hash<string_view>{}(_name);
+	Table::Shard& shard = table().shards[nameHash % c_shardCount];
+	lock_guard<mutex> lock(shard.entriesMutex);
+	auto entry = shard.entries.find(_name);
+	if (entry == shard.entries.end())
+	{
+		auto newEntry = make_unique<Entry const>(Entry{string(_name), nameHash});
+		string_view key = newEntry->name;
+		entry = shard.entries.emplace(key, move(newEntry)).first;
+	}
+	m_entry = entry->second.get();
+}
+
+void ASTSymbol::reset()
+{
+	for (Table::Shard& shard: table().shards)
+	{
+		lock_guard<mutex> lock(shard.entriesMutex);
+		shard.entries.clear();
+	}
+}
+
+ASTSymbol::Table& ASTSymbol::table()
+{
+	static Table symbols;
+	return symbols;
+}
@@ -0,0 +1,86 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Interned names of the Solidity AST.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace solidity::frontend
+{
+
+/**
+ * Name of a declaration or a member in the Solidity AST, which is stored only once per process,
+ * similar to yul::YulString. Copying, comparing for equality and hashing are constant-time
+ * operations.
+ *
+ * In contrast to yul::YulString, the <-operator is consistent with the order of the strings, so
+ * that ordered containers of symbols are ordered in the same way as containers of strings.
+ * Symbols can be created from several threads. The strings are kept until reset() is called,
+ * which CompilerStack does whenever it releases its ASTs.
+ */
+class ASTSymbol
+{
+public:
+	ASTSymbol(): m_entry(&s_emptyEntry) {}
+	explicit ASTSymbol(std::string_view _name);
+
+	bool operator==(ASTSymbol _other) const { return m_entry == _other.m_entry; }
+	bool operator!=(ASTSymbol _other) const { return m_entry != _other.m_entry; }
+	bool operator<(ASTSymbol _other) const { return m_entry != _other.m_entry && str() < _other.str(); }
+
+	bool empty() const { return m_entry == &s_emptyEntry; }
+	std::string const& str() const { return m_entry->name; }
+	size_t hash() const { return m_entry->hash; }
+
+	/// Releases the strings of all symbols, which invalidates all non-empty symbols.
+	/// Must not be called while symbols are still in use or created by other threads.
+	static void reset();
+
+private:
+	struct Entry
+	{
+		std::string name;
+		size_t hash;
+	};
+	struct Table;
+
+	static Table& table();
+
+	static Entry const s_emptyEntry;
+
+	Entry const* m_entry;
+};
+
+}
+
+namespace std
+{
+template<> struct hash<solidity::frontend::ASTSymbol>
+{
+	size_t operator()(solidity::frontend::ASTSymbol _symbol) const
+	{
+		return _symbol.hash();
+	}
+};
+}
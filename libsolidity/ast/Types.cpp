@@ -44,7 +44,6 @@
 #include <boost/range/adaptor/sliced.hpp>
 #include <boost/range/algorithm/copy.hpp>
 
-#include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/transform.hpp>
 
@@ -125,6 +124,7 @@ MemberList::Member::Member(Declaration const* _declaration, Type const* _type, s
 void Type::clearCache() const
 {
 	m_members.clear();
+	m_memberLists.clear();
 	m_stackItems.reset();
 	m_stackSize.reset();
 }
@@ -171,19 +171,25 @@ pair<u256, unsigned> const* StorageOffsets::offset(size_t _index) const
 		return nullptr;
 }
 
-void MemberList::combine(MemberList const & _other)
+vector<MemberList::Member const*> const& MemberList::membersByName(ASTSymbol _name) const
 {
-	m_memberTypes += _other.m_memberTypes;
+	static vector<Member const*> const noMembers;
+	auto const& index = m_membersByName.init([&]{
+		unordered_map<ASTSymbol, vector<Member const*>> membersByName;
+		for (Member const& member: m_memberTypes)
+			membersByName[ASTSymbol(member.name)].push_back(&member);
+		return membersByName;
+	});
+	auto members = index.find(_name);
+	return members == index.end() ? noMembers : members->second;
 }
 
 pair<u256, unsigned> const* MemberList::memberStorageOffset(string const& _name) const
 {
-	StorageOffsets const& offsets = storageOffsets();
-
-	for (auto&& [index, member]: m_memberTypes | ranges::views::enumerate)
-		if (member.name == _name)
-			return offsets.offset(index);
-	return nullptr;
+	vector<Member const*> const& members = membersByName(_name);
+	if (members.empty())
+		return nullptr;
+	return storageOffsets().offset(static_cast<size_t>(members.front() - m_memberTypes.data()));
 }
 
 u256 const& MemberList::storageSize() const
@@ -286,19 +292,31 @@ Type const* Type::commonType(Type const* _a, Type const* _b)
 
 MemberList const& Type::members(ASTNode const* _currentScope) const
 {
-	if (!m_members[_currentScope])
+	MemberList const*& memberList = m_members[_currentScope];
+	if (!memberList)
 	{
 		solAssert(
 			_currentScope == nullptr ||
 			dynamic_cast<SourceUnit const*>(_currentScope) ||
 			dynamic_cast<ContractDefinition const*>(_currentScope),
 		"");
-		MemberList::MemberMap members = nativeMembers(_currentScope);
+		vector<UsingForDirective const*> directives;
 		if (_currentScope)
-			members += boundFunctions(*this, *_currentScope);
-		m_members[_currentScope] = make_unique<MemberList>(move(members));
+			directives = usingForDirectives(*_currentScope);
+		unique_ptr<MemberList>& sharedList = m_memberLists[{
+			nativeMembersDependOnScope() ? _currentScope : nullptr,
+			directives
+		}];
+		if (!sharedList)
+		{
+			MemberList::MemberMap members = nativeMembers(_currentScope);
+			if (!directives.empty())
+				members += boundFunctions(*this, directives);
+			sharedList = make_unique<MemberList>(move(members));
+		}
+		memberList = sharedList.get();
 	}
-	return *m_members[_currentScope];
+	return *memberList;
 }
 
 Type const* Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) const
@@ -328,7 +346,7 @@ Type const* Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) c
 	return encodingType;
 }
 
-MemberList::MemberMap Type::boundFunctions(Type const& _type, ASTNode const& _scope)
+vector<UsingForDirective const*> Type::usingForDirectives(ASTNode const& _scope)
 {
 	vector<UsingForDirective const*> usingForDirectives;
 	if (auto const* sourceUnit = dynamic_cast<SourceUnit const*>(&_scope))
@@ -339,7 +357,14 @@ MemberList::MemberMap Type::boundFunctions(Type const& _type, ASTNode const& _sc
 			ASTNode::filteredNodes<UsingForDirective>(contract->sourceUnit().nodes());
 	else
 		solAssert(false, "");
+	return usingForDirectives;
+}
 
+MemberList::MemberMap Type::boundFunctions(
+	Type const& _type,
+	vector<UsingForDirective const*> const& _usingForDirectives
+)
+{
 	// Normalise data location of type.
 	DataLocation typeLocation = DataLocation::Storage;
 	if (auto refType = dynamic_cast<ReferenceType const*>(&_type))
@@ -348,7 +373,7 @@ MemberList::MemberMap Type::boundFunctions(Type const& _type, ASTNode const& _sc
 	set<Declaration const*> seenFunctions;
 	MemberList::MemberMap members;
 
-	for (UsingForDirective const* ufd: usingForDirectives)
+	for (UsingForDirective const* ufd: _usingForDirectives)
 	{
 		// Convert both types to pointers for comparison to see if the `using for`
 		// directive applies.
@@ -3412,8 +3437,11 @@ bool FunctionType::isBareCall() const
 	}
 }
 
-string FunctionType::externalSignature() const
+string const& FunctionType::externalSignature() const
 {
+	if (m_externalSignature)
+		return *m_externalSignature;
+
 	solAssert(m_declaration != nullptr, "External signature of function needs declaration");
 	solAssert(!m_declaration->name().empty(), "Fallback function has no signature.");
 	switch (kind())
@@ -3447,17 +3475,25 @@ string FunctionType::externalSignature() const
 			typeName += " storage";
 		return typeName;
 	});
-	return m_declaration->name() + "(" + boost::algorithm::join(typeStrings, ",") + ")";
+	m_externalSignature = m_declaration->name() + "(" + boost::algorithm::join(typeStrings, ",") + ")";
+	return *m_externalSignature;
+}
+
+util::FixedHash<4> const& FunctionType::externalSelector() const
+{
+	if (!m_externalSelector)
+		m_externalSelector = util::FixedHash<4>(util::keccak256(externalSignature()));
+	return *m_externalSelector;
 }
 
 u256 FunctionType::externalIdentifier() const
 {
-	return util::selectorFromSignature32(externalSignature());
+	return util::fromBigEndian<uint32_t>(externalSelector().ref());
 }
 
 string FunctionType::externalIdentifierHex() const
 {
-	return util::FixedHash<4>(util::keccak256(externalSignature())).hex();
+	return externalSelector().hex();
 }
 
 bool FunctionType::isPure() const
@@ -30,6 +30,7 @@
 
 #include <libsolutil/Common.h>
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/FixedHash.h>
 #include <libsolutil/LazyInit.h>
 #include <libsolutil/Result.h>
 
@@ -40,6 +41,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 namespace solidity::frontend
@@ -120,25 +122,18 @@ public:
 
 	explicit MemberList(MemberMap _members): m_memberTypes(std::move(_members)) {}
 
-	void combine(MemberList const& _other);
 	Type const* memberType(std::string const& _name) const
 	{
-		Type const* type = nullptr;
-		for (auto const& it: m_memberTypes)
-			if (it.name == _name)
-			{
-				solAssert(!type, "Requested member type by non-unique name.");
-				type = it.type;
-			}
-		return type;
+		std::vector<Member const*> const& members = membersByName(_name);
+		solAssert(members.size() <= 1, "Requested member type by non-unique name.");
+		return members.empty() ? nullptr : members.front()->type;
 	}
-	MemberMap membersByName(std::string const& _name) const
+	/// @returns the members called @a _name in the order in which they appear in the list.
+	/// Uses an index of the members by name that is created on first use.
+	std::vector<Member const*> const& membersByName(ASTSymbol _name) const;
+	std::vector<Member const*> const& membersByName(std::string const& _name) const
 	{
-		MemberMap members;
-		for (auto const& it: m_memberTypes)
-			if (it.name == _name)
-				members.push_back(it);
-		return members;
+		return membersByName(ASTSymbol(_name));
 	}
 	/// @returns the offset of the given member in storage slots and bytes inside a slot or
 	/// a nullptr if the member is not part of storage.
@@ -153,6 +148,7 @@ private:
 	StorageOffsets const& storageOffsets() const;
 
 	MemberMap m_memberTypes;
+	util::LazyInit<std::unordered_map<ASTSymbol, std::vector<Member const*>>> m_membersByName;
 	util::LazyInit<StorageOffsets> m_storageOffsets;
 };
 
@@ -379,8 +375,13 @@ public:
 	virtual void clearCache() const;
 
 private:
-	/// @returns a member list containing all members added to this type by `using for` directives.
-	static MemberList::MemberMap boundFunctions(Type const& _type, ASTNode const& _scope);
+	/// @returns the `using for` directives that apply in @a _scope.
+	static std::vector<UsingForDirective const*> usingForDirectives(ASTNode const& _scope);
+	/// @returns a member list containing all members added to this type by @a _usingForDirectives.
+	static MemberList::MemberMap boundFunctions(
+		Type const& _type,
+		std::vector<UsingForDirective const*> const& _usingForDirectives
+	);
 
 protected:
 	/// @returns the members native to this type depending on the given context. This function
@@ -389,6 +390,9 @@ protected:
 	{
 		return MemberList::MemberMap();
 	}
+	/// @returns true if the result of ``nativeMembers`` depends on the scope, so that member
+	/// lists cannot be shared between scopes in which the same `using for` directives apply.
+	virtual bool nativeMembersDependOnScope() const { return false; }
 	/// Generates the stack items to be returned by ``stackItems()``. Defaults
 	/// to exactly one unnamed and untyped stack item referring to a single stack slot.
 	virtual std::vector<std::tuple<std::string, Type const*>> makeStackItems() const
@@ -397,8 +401,16 @@ protected:
 	}
 
 
-	/// List of member types (parameterised by scape), will be lazy-initialized.
-	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
+	/// List of member types (parameterised by scope), will be lazy-initialized.
+	/// Points into m_memberLists.
+	mutable std::map<ASTNode const*, MemberList const*> m_members;
+	/// Member lists by the scope that was passed to ``nativeMembers`` (or nullptr if the native
+	/// members do not depend on it) and the `using for` directives that apply in the scope.
+	/// Scopes for which both are equal share their member list.
+	mutable std::map<
+		std::pair<ASTNode const*, std::vector<UsingForDirective const*>>,
+		std::unique_ptr<MemberList>
+	> m_memberLists;
 	mutable std::optional<std::vector<std::tuple<std::string, Type const*>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
 };
@@ -1280,6 +1292,7 @@ public:
 	bool nameable() const override;
 	bool hasSimpleZeroValueInMemory() const override { return false; }
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
+	bool nativeMembersDependOnScope() const override { return true; }
 	Type const* encodingType() const override;
 	TypeResult interfaceType(bool _inLibrary) const override;
 	Type const* mobileType() const override;
@@ -1312,7 +1325,9 @@ public:
 	Kind const& kind() const { return m_kind; }
 	StateMutability stateMutability() const { return m_stateMutability; }
 	/// @returns the external signature of this function type given the function name
-	std::string externalSignature() const;
+	std::string const& externalSignature() const;
+	/// @returns the selector of this function, i.e. the first four bytes of the hash of the signature.
+	util::FixedHash<4> const& externalSelector() const;
 	/// @returns the external identifier of this function (the hash of the signature).
 	u256 externalIdentifier() const;
 	/// @returns the external identifier of this function (the hash of the signature) as a hex string.
@@ -1395,6 +1410,9 @@ private:
 	bool const m_bound = false;
 	Declaration const* m_declaration = nullptr;
 	bool m_saltSet = false; ///< true iff the salt value to be used is on the stack
+	/// Caches for externalSignature() and externalSelector().
+	mutable std::optional<std::string> m_externalSignature;
+	mutable std::optional<util::FixedHash<4>> m_externalSelector;
 };
 
 /**
@@ -1454,6 +1472,7 @@ public:
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
 	std::string toString(bool _short) const override { return "type(" + m_actualType->toString(_short) + ")"; }
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
+	bool nativeMembersDependOnScope() const override { return true; }
 
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 protected:
@@ -36,8 +36,16 @@ namespace solidity::frontend {
 class Compiler
 {
 public:
-	Compiler(langutil::EVMVersion _evmVersion, RevertStrings _revertStrings, OptimiserSettings _optimiserSettings):
+	/// @param _constantOptimiserCache decisions of the constant optimiser shared with the other
+	/// contracts of the compilation, has to outlive the call to compileContract if not null.
+	Compiler(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		OptimiserSettings _optimiserSettings,
+		evmasm::ConstantOptimiserCache* _constantOptimiserCache = nullptr
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
+		m_constantOptimiserCache(_constantOptimiserCache),
 		m_runtimeContext(_evmVersion, _revertStrings),
 		m_context(_evmVersion, _revertStrings, &m_runtimeContext)
 	{ }
@@ -67,6 +75,7 @@ public:
 
 private:
 	OptimiserSettings const m_optimiserSettings;
+	evmasm::ConstantOptimiserCache* m_constantOptimiserCache = nullptr;
 	CompilerContext m_runtimeContext;
 	size_t m_runtimeSub = size_t(-1); ///< Identifier of the runtime sub-assembly, if present.
 	CompilerContext m_context;
@@ -568,6 +568,13 @@ void CompilerContext::updateSourceLocation()
 	m_asm->setSourceLocation(m_visitedNodes.empty() ? SourceLocation() : m_visitedNodes.top()->location());
 }
 
+void CompilerContext::optimise(OptimiserSettings const& _settings, evmasm::ConstantOptimiserCache* _constantOptimiserCache)
+{
+	evmasm::Assembly::OptimiserSettings asmSettings = translateOptimiserSettings(_settings);
+	asmSettings.constantOptimiserCache = _constantOptimiserCache;
+	m_asm->optimise(asmSettings);
+}
+
 evmasm::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(OptimiserSettings const& _settings)
 {
 	// Constructing it this way so that we notice changes in the fields.
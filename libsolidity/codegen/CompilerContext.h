@@ -278,7 +278,9 @@ public:
 	void appendAuxiliaryData(bytes const& _data) { m_asm->appendAuxiliaryDataToEnd(_data); }
 
 	/// Run optimisation step.
-	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(translateOptimiserSettings(_settings)); }
+	/// @param _constantOptimiserCache decisions of the constant optimiser shared with other
+	/// contracts of the compilation, if not null.
+	void optimise(OptimiserSettings const& _settings, evmasm::ConstantOptimiserCache* _constantOptimiserCache = nullptr);
 
 	/// @returns the runtime context if in creation mode and runtime context is set, nullptr otherwise.
 	CompilerContext* runtimeContext() const { return m_runtimeContext; }
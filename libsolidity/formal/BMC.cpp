@@ -23,6 +23,8 @@
 
 #include <libsmtutil/SMTPortfolio.h>
 
+#include <libsolutil/Profiler.h>
+
 #ifdef HAVE_Z3_DLOPEN
 #include <z3_version.h>
 #endif
@@ -1010,6 +1012,7 @@ BMC::checkSatisfiableAndGenerateModel(vector<smtutil::Expression> const& _expres
 	vector<string> values;
 	try
 	{
+		ScopedTimer timer{"BMC query"};
 		tie(result, values) = m_interface->check(_expressionsToEvaluate);
 	}
 	catch (smtutil::SolverError const& _e)
@@ -31,6 +31,7 @@
 
 #include <libsmtutil/CHCSmtLib2Interface.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/Profiler.h>
 
 #include <range/v3/algorithm/for_each.hpp>
 
@@ -1369,6 +1370,7 @@ void CHC::addRule(smtutil::Expression const& _rule, string const& _ruleName)
 
 pair<CheckResult, CHCSolverInterface::CexGraph> CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
 {
+	ScopedTimer timer{"CHC query"};
 	CheckResult result;
 	CHCSolverInterface::CexGraph cex;
 	tie(result, cex) = m_interface->query(_query);
@@ -21,6 +21,8 @@
 #include <libsmtutil/Z3Interface.h>
 #endif
 
+#include <libsolutil/Profiler.h>
+
 #include <range/v3/algorithm/any_of.hpp>
 #include <range/v3/view.hpp>
 
@@ -117,14 +119,20 @@ void ModelChecker::analyze(SourceUnit const& _source)
 		return;
 
 	if (m_settings.engine.chc)
+	{
+		ScopedTimer timer{"CHC"};
 		m_chc.analyze(_source);
+	}
 
 	auto solvedTargets = m_chc.safeTargets();
 	for (auto const& target: m_chc.unsafeTargets())
 		solvedTargets[target.first] += target.second;
 
 	if (m_settings.engine.bmc)
+	{
+		ScopedTimer timer{"BMC"};
 		m_bmc.analyze(_source, solvedTargets);
+	}
 }
 
 vector<string> ModelChecker::unhandledQueries()
@@ -63,19 +63,24 @@
 #include <libyul/AssemblyStack.h>
 #include <libyul/AsmParser.h>
 #include <libyul/AST.h>
+#include <libyul/backends/evm/EVMDialect.h>
 
 #include <liblangutil/Scanner.h>
 #include <liblangutil/SemVerHandler.h>
 
+#include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/Exceptions.h>
 
 #include <libsolutil/SwarmHash.h>
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/Parallel.h>
+#include <libsolutil/Profiler.h>
 
 #include <json/json.h>
 
+#include <array>
 #include <utility>
 #include <map>
 #include <range/v3/view/concat.hpp>
@@ -92,6 +97,38 @@ using solidity::util::toHex;
 
 static int g_compilerStackCounts = 0;
 
+namespace
+{
+
+/// Parser together with the errors it reported, used to parse a single source unit.
+struct SourceParser
+{
+	SourceParser(EVMVersion _evmVersion, bool _errorRecovery):
+		errorReporter(errors),
+		parser(errorReporter, _evmVersion, _errorRecovery)
+	{}
+
+	ErrorList errors;
+	ErrorReporter errorReporter;
+	Parser parser;
+};
+
+/// @returns true if @a _contract is in @a _contractNames, which maps source names to contract
+/// names, where an empty name matches all sources or all contracts, respectively.
+bool containsContract(map<string, set<string>> const& _contractNames, ContractDefinition const& _contract)
+{
+	for (auto const& key: vector<string>{"", _contract.sourceUnitName()})
+	{
+		auto const& it = _contractNames.find(key);
+		if (it != _contractNames.end())
+			if (it->second.count(_contract.name()) || it->second.count(""))
+				return true;
+	}
+	return false;
+}
+
+}
+
 CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
 	m_readFile{std::move(_readFile)},
 	m_enabledSMTSolvers{smtutil::SMTSolverChoice::All()},
@@ -107,6 +144,7 @@ CompilerStack::~CompilerStack()
 {
 	--g_compilerStackCounts;
 	TypeProvider::reset();
+	ASTSymbol::reset();
 }
 
 void CompilerStack::createAndAssignCallGraphs()
@@ -312,6 +350,7 @@ void CompilerStack::reset(bool _keepSettings)
 	m_contracts.clear();
 	m_errorReporter.clear();
 	TypeProvider::reset();
+	ASTSymbol::reset();
 }
 
 void CompilerStack::setSources(StringMap _sources)
@@ -320,7 +359,7 @@ void CompilerStack::setSources(StringMap _sources)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Cannot change sources once set."));
 	if (m_stackState != Empty)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set sources before parsing."));
-	for (auto source: _sources)
+	for (auto& source: _sources)
 		m_sources[source.first].scanner = make_shared<Scanner>(CharStream(/*content*/std::move(source.second), /*name*/source.first));
 	m_stackState = SourcesSet;
 }
@@ -329,37 +368,69 @@ bool CompilerStack::parse()
 {
 	if (m_stackState != SourcesSet)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call parse only after the SourcesSet state."));
+	util::ScopedTimer timer{"parsing"};
 	m_errorReporter.clear();
 
 	if (SemVerVersion{string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
 
-	Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery};
-
+	// Sources are parsed in rounds: All sources known at the start of a round are parsed
+	// concurrently, each by its own parser. Afterwards, the results are processed in the
+	// same order as if they had been parsed in sequence by a single parser, which keeps
+	// AST node IDs, errors and the order of sources deterministic. Imports are resolved
+	// in the calling thread, since the read callback is not required to be thread-safe.
 	vector<string> sourcesToParse;
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
 
-	for (size_t i = 0; i < sourcesToParse.size(); ++i)
+	// The dialect is created on first use, which must not happen concurrently.
+	yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
+
+	int64_t nodeIDOffset = 0;
+	for (size_t roundStart = 0; roundStart < sourcesToParse.size();)
 	{
-		string const& path = sourcesToParse[i];
-		Source& source = m_sources[path];
-		source.scanner->reset();
-		source.ast = parser.parse(source.scanner);
-		if (!source.ast)
-			solAssert(!Error::containsOnlyWarnings(m_errorReporter.errors()), "Parser returned null but did not report error.");
-		else
+		size_t const roundEnd = sourcesToParse.size();
+		vector<unique_ptr<SourceParser>> parsers;
+		for (size_t i = roundStart; i < roundEnd; ++i)
+			parsers.emplace_back(make_unique<SourceParser>(m_evmVersion, m_parserErrorRecovery));
+
+		util::parallelFor(roundEnd - roundStart, util::defaultThreadCount(), [&](size_t _index) {
+			Source& source = m_sources.at(sourcesToParse[roundStart + _index]);
+			source.scanner->reset();
+			source.ast = parsers[_index]->parser.parse(source.scanner);
+		});
+
+		for (size_t i = roundStart; i < roundEnd; ++i)
 		{
-			source.ast->annotation().path = path;
-			if (m_stopAfter >= ParsedAndImported)
-				for (auto const& newSource: loadMissingSources(*source.ast, path))
-				{
-					string const& newPath = newSource.first;
-					string const& newContents = newSource.second;
-					m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
-					sourcesToParse.push_back(newPath);
-				}
+			string const& path = sourcesToParse[i];
+			Source& source = m_sources[path];
+			SourceParser& sourceParser = *parsers[i - roundStart];
+			try
+			{
+				m_errorReporter.merge(sourceParser.errors);
+			}
+			catch (FatalError const&)
+			{
+				// Too many errors in total: A single parser would have aborted this source.
+				source.ast.reset();
+			}
+			sourceParser.parser.shiftNodeIDs(nodeIDOffset);
+			nodeIDOffset += sourceParser.parser.nodeIDCount();
+			if (!source.ast)
+				solAssert(!Error::containsOnlyWarnings(sourceParser.errors), "Parser returned null but did not report error.");
+			else
+			{
+				source.ast->annotation().path = path;
+				if (m_stopAfter >= ParsedAndImported)
+					for (auto& newSource: loadMissingSources(*source.ast, path))
+					{
+						string const& newPath = newSource.first;
+						m_sources[newPath].scanner = make_shared<Scanner>(CharStream(move(newSource.second), newPath));
+						sourcesToParse.push_back(newPath);
+					}
+			}
 		}
+		roundStart = roundEnd;
 	}
 
 	if (m_stopAfter <= Parsed)
@@ -400,66 +471,68 @@ bool CompilerStack::analyze()
 {
 	if (m_stackState != ParsedAndImported || m_stackState >= AnalysisPerformed)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call analyze only after parsing was performed."));
+	util::ScopedTimer timer{"analysis"};
 	resolveImports();
 
-	for (Source const* source: m_sourceOrder)
-		if (source->ast)
-			Scoper::assignScopes(*source->ast);
-
 	bool noErrors = true;
 
 	try
 	{
-		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
-				noErrors = false;
-
-		DocStringTagParser docStringTagParser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !docStringTagParser.parseDocStrings(*source->ast))
-				noErrors = false;
+		if (!analyzeSourceUnitsIndependently())
+			noErrors = false;
 
 		m_globalContext = make_shared<GlobalContext>();
 		// We need to keep the same resolver during the whole process.
 		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.registerDeclarations(*source->ast))
-				return false;
+		{
+			util::ScopedTimer resolverTimer{"NameAndTypeResolver"};
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.registerDeclarations(*source->ast))
+					return false;
 
-		map<string, SourceUnit const*> sourceUnitsByName;
-		for (auto& source: m_sources)
-			sourceUnitsByName[source.first] = source.second.ast.get();
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
-				return false;
+			map<string, SourceUnit const*> sourceUnitsByName;
+			for (auto& source: m_sources)
+				sourceUnitsByName[source.first] = source.second.ast.get();
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.performImports(*source->ast, sourceUnitsByName))
+					return false;
 
-		resolver.warnHomonymDeclarations();
+			resolver.warnHomonymDeclarations();
 
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
-				return false;
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
+					return false;
+		}
 
-		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !declarationTypeChecker.check(*source->ast))
-				return false;
+		{
+			util::ScopedTimer declarationTypeCheckerTimer{"DeclarationTypeChecker"};
+			DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !declarationTypeChecker.check(*source->ast))
+					return false;
+		}
 
 		// Next, we check inheritance, overrides, function collisions and other things at
 		// contract or function level.
 		// This also calculates whether a contract is abstract, which is needed by the
 		// type checker.
-		ContractLevelChecker contractLevelChecker(m_errorReporter);
+		{
+			util::ScopedTimer contractLevelCheckerTimer{"ContractLevelChecker"};
+			ContractLevelChecker contractLevelChecker(m_errorReporter);
 
-		for (Source const* source: m_sourceOrder)
-			if (auto sourceAst = source->ast)
-				noErrors = contractLevelChecker.check(*sourceAst);
+			for (Source const* source: m_sourceOrder)
+				if (auto sourceAst = source->ast)
+					noErrors = contractLevelChecker.check(*sourceAst);
+		}
 
 		// Requires ContractLevelChecker
-		DocStringAnalyser docStringAnalyser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
-				noErrors = false;
+		{
+			util::ScopedTimer docStringAnalyserTimer{"DocStringAnalyser"};
+			DocStringAnalyser docStringAnalyser(m_errorReporter);
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !docStringAnalyser.analyseDocStrings(*source->ast))
+					noErrors = false;
+		}
 
 		// Now we run full type checks that go down to the expression level. This
 		// cannot be done earlier, because we need cross-contract types and information
@@ -468,14 +541,18 @@ bool CompilerStack::analyze()
 		//
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
-		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
-				noErrors = false;
+		{
+			util::ScopedTimer typeCheckerTimer{"TypeChecker"};
+			TypeChecker typeChecker(m_evmVersion, m_errorReporter);
+			for (Source const* source: m_sourceOrder)
+				if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
+					noErrors = false;
+		}
 
 		// Create & assign callgraphs and check for contract dependency cycles
 		if (noErrors)
 		{
+			util::ScopedTimer callGraphTimer{"call graphs"};
 			createAndAssignCallGraphs();
 			findAndReportCyclicContractDependencies();
 		}
@@ -483,6 +560,7 @@ bool CompilerStack::analyze()
 		if (noErrors)
 		{
 			// Checks that can only be done when all types of all AST nodes are known.
+			util::ScopedTimer postTypeCheckerTimer{"PostTypeChecker"};
 			PostTypeChecker postTypeChecker(m_errorReporter);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast && !postTypeChecker.check(*source->ast))
@@ -492,23 +570,30 @@ bool CompilerStack::analyze()
 		}
 
 		if (noErrors)
+		{
+			util::ScopedTimer postTypeContractLevelCheckerTimer{"PostTypeContractLevelChecker"};
 			for (Source const* source: m_sourceOrder)
 				if (source->ast && !PostTypeContractLevelChecker{m_errorReporter}.check(*source->ast))
 					noErrors = false;
+		}
 
 		// Check that immutable variables are never read in c'tors and assigned
 		// exactly once
 		if (noErrors)
+		{
+			util::ScopedTimer immutableValidatorTimer{"ImmutableValidator"};
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
 					for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 						if (ContractDefinition* contract = dynamic_cast<ContractDefinition*>(node.get()))
 							ImmutableValidator(m_errorReporter, *contract).analyze();
+		}
 
 		if (noErrors)
 		{
 			// Control flow graph generator and analyzer. It can check for issues such as
 			// variable is used before it is assigned to.
+			util::ScopedTimer controlFlowTimer{"ControlFlowAnalyzer"};
 			CFG cfg(m_errorReporter);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast && !cfg.constructFlow(*source->ast))
@@ -526,6 +611,7 @@ bool CompilerStack::analyze()
 		if (noErrors)
 		{
 			// Checks for common mistakes. Only generates warnings.
+			util::ScopedTimer staticAnalyzerTimer{"StaticAnalyzer"};
 			StaticAnalyzer staticAnalyzer(m_errorReporter);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast && !staticAnalyzer.analyze(*source->ast))
@@ -535,6 +621,7 @@ bool CompilerStack::analyze()
 		if (noErrors)
 		{
 			// Check for state mutability in every function.
+			util::ScopedTimer viewPureCheckerTimer{"ViewPureChecker"};
 			vector<ASTPointer<ASTNode>> ast;
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
@@ -546,6 +633,7 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
+			util::ScopedTimer modelCheckerTimer{"ModelChecker"};
 			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses, m_modelCheckerSettings, m_readFile, m_enabledSMTSolvers);
 			auto allSources = applyMap(m_sourceOrder, [](Source const* _source) { return _source->ast; });
 			modelChecker.enableAllEnginesIfPragmaPresent(allSources);
@@ -596,15 +684,14 @@ bool CompilerStack::isRequestedContract(ContractDefinition const& _contract) con
 	if (m_requestedContractNames.empty())
 		return true;
 
-	for (auto const& key: vector<string>{"", _contract.sourceUnitName()})
-	{
-		auto const& it = m_requestedContractNames.find(key);
-		if (it != m_requestedContractNames.end())
-			if (it->second.count(_contract.name()) || it->second.count(""))
-				return true;
-	}
+	return containsContract(m_requestedContractNames, _contract);
+}
 
-	return false;
+bool CompilerStack::isCodeGenerationRequested(ContractDefinition const& _contract) const
+{
+	if (!isRequestedContract(_contract))
+		return false;
+	return m_codeGenerationContractNames.empty() || containsContract(m_codeGenerationContractNames, _contract);
 }
 
 bool CompilerStack::compile(State _stopAfter)
@@ -620,13 +707,15 @@ bool CompilerStack::compile(State _stopAfter)
 	if (m_hasError)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
 
-	// Only compile contracts individually which have been requested.
+	util::ScopedTimer timer{"code generation"};
+	// Only compile contracts individually for which code has been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	evmasm::ConstantOptimiserCache constantOptimiserCache;
 
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
-				if (isRequestedContract(*contract))
+				if (isCodeGenerationRequested(*contract))
 				{
 					try
 					{
@@ -637,7 +726,7 @@ bool CompilerStack::compile(State _stopAfter)
 							if (m_viaIR)
 								generateEVMFromIR(*contract);
 							else
-								compileContract(*contract, otherCompilers);
+								compileContract(*contract, otherCompilers, constantOptimiserCache);
 						}
 						if (m_generateEwasm)
 							generateEwasm(*contract);
@@ -1132,7 +1221,7 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast, std::string
 					result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
 
 				if (result.success)
-					newSources[importPath] = result.responseOrErrorMessage;
+					newSources[importPath] = move(result.responseOrErrorMessage);
 				else
 				{
 					m_errorReporter.parserError(
@@ -1157,6 +1246,60 @@ string CompilerStack::applyRemapping(string const& _path, string const& _context
 	return m_importRemapper.apply(_path, _context);
 }
 
+bool CompilerStack::analyzeSourceUnitsIndependently()
+{
+	vector<SourceUnit*> sourceUnits;
+	for (Source const* source: m_sourceOrder)
+		if (source->ast)
+			sourceUnits.push_back(source->ast.get());
+
+	struct StepResult
+	{
+		ErrorList errors;
+		bool success = true;
+		bool fatal = false;
+	};
+	auto runStep = [](StepResult& _result, auto const& _step) {
+		ErrorReporter errorReporter(_result.errors);
+		try
+		{
+			_result.success = _step(errorReporter);
+		}
+		catch (FatalError const&)
+		{
+			_result.success = false;
+			_result.fatal = true;
+		}
+	};
+
+	util::ScopedTimer timer{"SyntaxChecker and DocStringTagParser"};
+	// Results of the syntax checker and the doc string tag parser for each source unit.
+	vector<array<StepResult, 2>> results(sourceUnits.size());
+	util::parallelFor(sourceUnits.size(), util::defaultThreadCount(), [&](size_t _index) {
+		SourceUnit& sourceUnit = *sourceUnits[_index];
+		Scoper::assignScopes(sourceUnit);
+		runStep(results[_index][0], [&](ErrorReporter& _errorReporter) {
+			return SyntaxChecker(_errorReporter, m_optimiserSettings.runYulOptimiser).checkSyntax(sourceUnit);
+		});
+		runStep(results[_index][1], [&](ErrorReporter& _errorReporter) {
+			return DocStringTagParser(_errorReporter).parseDocStrings(sourceUnit);
+		});
+	});
+
+	// Report errors as if all source units had been checked by one step after the other.
+	bool noErrors = true;
+	for (size_t step = 0; step < 2; ++step)
+		for (auto const& sourceResults: results)
+		{
+			m_errorReporter.merge(sourceResults[step].errors);
+			if (sourceResults[step].fatal)
+				BOOST_THROW_EXCEPTION(FatalError());
+			if (!sourceResults[step].success)
+				noErrors = false;
+		}
+	return noErrors;
+}
+
 void CompilerStack::resolveImports()
 {
 	solAssert(m_stackState == ParsedAndImported, "");
@@ -1220,7 +1363,8 @@ bool onlySafeExperimentalFeaturesActivated(set<ExperimentalFeature> const& featu
 
 void CompilerStack::compileContract(
 	ContractDefinition const& _contract,
-	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers
+	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers,
+	evmasm::ConstantOptimiserCache& _constantOptimiserCache
 )
 {
 	solAssert(m_stackState >= AnalysisPerformed, "");
@@ -1231,14 +1375,21 @@ void CompilerStack::compileContract(
 		return;
 
 	for (auto const& [dependency, referencee]: _contract.annotation().contractDependencies)
-		compileContract(*dependency, _otherCompilers);
+		compileContract(*dependency, _otherCompilers, _constantOptimiserCache);
 
 	if (!_contract.canBeDeployed())
 		return;
 
+	util::ScopedTimer timer{"legacy code generation"};
+	util::ScopedTimer contractTimer{_contract.fullyQualifiedName()};
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(
+		m_evmVersion,
+		m_revertStrings,
+		m_optimiserSettings,
+		&_constantOptimiserCache
+	);
 	compiledContract.compiler = compiler;
 
 	bytes cborEncodedMetadata = createCBORMetadata(compiledContract);
@@ -1258,6 +1409,7 @@ void CompilerStack::compileContract(
 	try
 	{
 		// Assemble deployment (incl. runtime)  object.
+		util::ScopedTimer assemblyTimer{"assembling"};
 		compiledContract.object = compiledContract.evmAssembly->assemble();
 	}
 	catch(evmasm::AssemblyException const&)
@@ -1271,6 +1423,7 @@ void CompilerStack::compileContract(
 	try
 	{
 		// Assemble runtime object.
+		util::ScopedTimer assemblyTimer{"assembling"};
 		compiledContract.runtimeObject = compiledContract.evmRuntimeAssembly->assemble();
 	}
 	catch(evmasm::AssemblyException const&)
@@ -1326,6 +1479,8 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	for (auto const& pair: m_contracts)
 		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
 
+	util::ScopedTimer timer{"IR generation"};
+	util::ScopedTimer contractTimer{_contract.fullyQualifiedName()};
 	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings);
 	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(_contract, otherYulSources);
 }
@@ -1344,6 +1499,8 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
+	util::ScopedTimer timer{"EVM code generation from IR"};
+	util::ScopedTimer contractTimer{_contract.fullyQualifiedName()};
 	// Re-parse the Yul IR in EVM dialect
 	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
 	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
@@ -1392,6 +1549,8 @@ void CompilerStack::generateEwasm(ContractDefinition const& _contract)
 	if (!compiledContract.ewasm.empty())
 		return;
 
+	util::ScopedTimer timer{"Ewasm code generation"};
+	util::ScopedTimer contractTimer{_contract.fullyQualifiedName()};
 	// Re-parse the Yul IR in EVM dialect
 	yul::AssemblyStack stack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
 	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
@@ -1710,9 +1869,9 @@ Json::Value CompilerStack::gasEstimates(string const& _contractName) const
 		/// External functions
 		ContractDefinition const& contract = contractDefinition(_contractName);
 		Json::Value externalFunctions(Json::objectValue);
-		for (auto it: contract.interfaceFunctions())
+		for (auto const& it: contract.interfaceFunctions())
 		{
-			string sig = it.second->externalSignature();
+			string const& sig = it.second->externalSignature();
 			externalFunctions[sig] = gasToJson(gasEstimator.functionalEstimation(*items, sig));
 		}
 
@@ -63,6 +63,7 @@ class Scanner;
 namespace solidity::evmasm
 {
 class Assembly;
+class ConstantOptimiserCache;
 class AssemblyItem;
 using AssemblyItems = std::vector<AssemblyItem>;
 }
@@ -186,6 +187,14 @@ public:
 		m_requestedContractNames = _contractNames;
 	}
 
+	/// Restricts code generation to the given contracts by source, in the same format as for
+	/// @a setRequestedContractNames. Contracts they depend on are compiled as well.
+	/// If empty, code is generated for all requested contracts.
+	void setCodeGenerationContractNames(std::map<std::string, std::set<std::string>> const& _contractNames = std::map<std::string, std::set<std::string>>{})
+	{
+		m_codeGenerationContractNames = _contractNames;
+	}
+
 	/// Enable EVM Bytecode generation. This is enabled by default.
 	void enableEvmBytecodeGeneration(bool _enable = true) { m_generateEvmBytecode = _enable; }
 
@@ -387,6 +396,12 @@ private:
 	void createAndAssignCallGraphs();
 	void findAndReportCyclicContractDependencies();
 
+	/// Runs the analysis steps that only depend on a single source unit (scoping, syntax checks
+	/// and parsing of doc string tags) concurrently for all source units.
+	/// Errors are reported in the same order as when running the steps in sequence.
+	/// @returns false on error.
+	bool analyzeSourceUnitsIndependently();
+
 	/// Loads the missing sources from @a _ast (named @a _path) using the callback
 	/// @a m_readFile and stores the absolute paths of all imports in the AST annotations.
 	/// @returns the newly loaded sources.
@@ -403,12 +418,18 @@ private:
 	/// @returns true if the contract is requested to be compiled.
 	bool isRequestedContract(ContractDefinition const& _contract) const;
 
+	/// @returns true if code is to be generated for the contract.
+	bool isCodeGenerationRequested(ContractDefinition const& _contract) const;
+
 	/// Compile a single contract.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
+	/// @param _constantOptimiserCache decisions of the constant optimiser, shared by all contracts
+	///                        compiled in one call to compile().
 	void compileContract(
 		ContractDefinition const& _contract,
-		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
+		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers,
+		evmasm::ConstantOptimiserCache& _constantOptimiserCache
 	);
 
 	/// Generate Yul IR for a single contract.
@@ -477,6 +498,7 @@ private:
 	ModelCheckerSettings m_modelCheckerSettings;
 	smtutil::SMTSolverChoice m_enabledSMTSolvers;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
+	std::map<std::string, std::set<std::string>> m_codeGenerationContractNames;
 	bool m_generateEvmBytecode = true;
 	bool m_generateIR = false;
 	bool m_generateEwasm = false;
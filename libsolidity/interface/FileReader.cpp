@@ -42,6 +42,13 @@ void FileReader::setSources(StringMap _sources)
 	m_sourceCodes = std::move(_sources);
 }
 
+FileReader::StringMap FileReader::takeSources()
+{
+	StringMap sources;
+	sources.swap(m_sourceCodes);
+	return sources;
+}
+
 ReadCallback::Result FileReader::readFile(string const& _kind, string const& _sourceUnitName)
 {
 	try
@@ -79,9 +86,7 @@ ReadCallback::Result FileReader::readFile(string const& _kind, string const& _so
 			return ReadCallback::Result{false, "Not a valid file."};
 
 		// NOTE: we ignore the FileNotFound exception as we manually check above
-		auto contents = readFileAsString(canonicalPath.string());
-		m_sourceCodes[_sourceUnitName] = contents;
-		return ReadCallback::Result{true, contents};
+		return ReadCallback::Result{true, readFileAsString(canonicalPath.string())};
 	}
 	catch (util::Exception const& _exception)
 	{
@@ -69,13 +69,15 @@ public:
 	/// Does not enforce @a allowedDirectories().
 	void setSource(boost::filesystem::path const& _path, SourceCode _source);
 
+	/// Hands all sources over to the caller without copying them and leaves @a sourceCodes() empty.
+	StringMap takeSources();
+
 	/// Receives a @p _sourceUnitName that refers to a source unit in compiler's virtual filesystem
 	/// and attempts to interpret it as a path and read the corresponding file from disk.
 	/// The read will only succeed if the canonical path of the file is within one of the @a allowedDirectories().
 	/// @param _kind must be equal to "source". Other values are not supported.
-	/// @return Content of the loaded file or an error message. If the operation succeeds, a copy of
-	/// the content is retained in @a sourceCodes() under the key of @a _sourceUnitName. If the key
-	/// already exists, previous content is discarded.
+	/// @return Content of the loaded file or an error message. The content is handed over to the
+	/// caller and not retained in @a sourceCodes().
 	frontend::ReadCallback::Result readFile(std::string const& _kind, std::string const& _sourceUnitName);
 
 	frontend::ReadCallback::Callback reader()
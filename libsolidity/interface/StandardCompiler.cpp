@@ -34,11 +34,13 @@
 #include <libsolutil/JSON.h>
 #include <libsolutil/Keccak256.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Profiler.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <algorithm>
 #include <optional>
+#include <sstream>
 
 using namespace std;
 using namespace solidity;
@@ -247,11 +249,13 @@ vector<string> evmObjectComponents(string const& _objectKind)
 	return util::applyMap(components, [&](auto const& _s) { return "evm." + _objectKind + _s; });
 }
 
-/// @returns true if any binary was requested, i.e. we actually have to perform compilation.
-bool isBinaryRequested(Json::Value const& _outputSelection)
+/// @returns the names of the contracts by source, in the format of @a requestedContractNames,
+/// for which outputs were requested that require code generation.
+map<string, set<string>> contractsRequiringBinaries(Json::Value const& _outputSelection)
 {
+	map<string, set<string>> contracts;
 	if (!_outputSelection.isObject())
-		return false;
+		return contracts;
 
 	// This does not include "evm.methodIdentifiers" on purpose!
 	static vector<string> const outputsThatRequireBinaries = vector<string>{
@@ -261,12 +265,21 @@ bool isBinaryRequested(Json::Value const& _outputSelection)
 		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
 	} + evmObjectComponents("bytecode") + evmObjectComponents("deployedBytecode");
 
-	for (auto const& fileRequests: _outputSelection)
-		for (auto const& requests: fileRequests)
+	for (auto const& sourceName: _outputSelection.getMemberNames())
+		for (auto const& contractName: _outputSelection[sourceName].getMemberNames())
 			for (auto const& output: outputsThatRequireBinaries)
-				if (isArtifactRequested(requests, output, false))
-					return true;
-	return false;
+				if (isArtifactRequested(_outputSelection[sourceName][contractName], output, false))
+				{
+					contracts[sourceName == "*" ? "" : sourceName].insert(contractName == "*" ? "" : contractName);
+					break;
+				}
+	return contracts;
+}
+
+/// @returns true if any binary was requested, i.e. we actually have to perform compilation.
+bool isBinaryRequested(Json::Value const& _outputSelection)
+{
+	return !contractsRequiringBinaries(_outputSelection).empty();
 }
 
 /// @returns true if EVM bytecode was requested, i.e. we have to run the old code generator.
@@ -373,10 +386,12 @@ Json::Value formatImmutableReferences(map<u256, pair<string, vector<size_t>>> co
 	return ret;
 }
 
+/// Assembles the requested outputs for @a _object. The source map and the generated sources
+/// are only retrieved if they are requested.
 Json::Value collectEVMObject(
 	evmasm::LinkerObject const& _object,
-	string const* _sourceMap,
-	Json::Value _generatedSources,
+	function<string const*()> const& _sourceMap,
+	function<Json::Value()> const& _generatedSources,
 	bool _runtimeObject,
 	function<bool(string)> const& _artifactRequested
 )
@@ -387,13 +402,16 @@ Json::Value collectEVMObject(
 	if (_artifactRequested("opcodes"))
 		output["opcodes"] = evmasm::disassemble(_object.bytecode);
 	if (_artifactRequested("sourceMap"))
-		output["sourceMap"] = _sourceMap ? *_sourceMap : "";
+	{
+		string const* sourceMap = _sourceMap();
+		output["sourceMap"] = sourceMap ? *sourceMap : "";
+	}
 	if (_artifactRequested("linkReferences"))
 		output["linkReferences"] = formatLinkReferences(_object.linkReferences);
 	if (_runtimeObject && _artifactRequested("immutableReferences"))
 		output["immutableReferences"] = formatImmutableReferences(_object.immutableReferences);
 	if (_artifactRequested("generatedSources"))
-		output["generatedSources"] = move(_generatedSources);
+		output["generatedSources"] = _generatedSources();
 	return output;
 }
 
@@ -429,7 +447,7 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "profiling", "remappings", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
@@ -657,7 +675,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 					"Mismatch between content and supplied hash for \"" + sourceName + "\""
 				));
 			else
-				ret.sources[sourceName] = content;
+				ret.sources[sourceName] = move(content);
 		}
 		else if (sources[sourceName]["urls"].isArray())
 		{
@@ -683,7 +701,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 						));
 					else
 					{
-						ret.sources[sourceName] = result.responseOrErrorMessage;
+						ret.sources[sourceName] = move(result.responseOrErrorMessage);
 						found = true;
 						break;
 					}
@@ -773,6 +791,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.viaIR = settings["viaIR"].asBool();
 	}
 
+	if (settings.isMember("profiling"))
+	{
+		if (!settings["profiling"].isBool())
+			return formatFatalError("JSONError", "\"settings.profiling\" must be a Boolean.");
+		ret.profiling = settings["profiling"].asBool();
+	}
+
 	if (settings.isMember("evmVersion"))
 	{
 		if (!settings["evmVersion"].isString())
@@ -973,7 +998,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 	return { std::move(ret) };
 }
 
-Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
+Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _stream)
 {
 	CompilerStack compilerStack(m_readFile);
 
@@ -991,6 +1016,7 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.useMetadataLiteralSources(_inputsAndSettings.metadataLiteralSources);
 	compilerStack.setMetadataHash(_inputsAndSettings.metadataHash);
 	compilerStack.setRequestedContractNames(requestedContractNames(_inputsAndSettings.outputSelection));
+	compilerStack.setCodeGenerationContractNames(contractsRequiringBinaries(_inputsAndSettings.outputSelection));
 	compilerStack.setModelCheckerSettings(_inputsAndSettings.modelCheckerSettings);
 
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
@@ -1134,89 +1160,88 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	)
 		return formatFatalError("InternalCompilerError", "No error reported, but compilation failed.");
 
-	Json::Value output = Json::objectValue;
-
-	if (errors.size() > 0)
-		output["errors"] = std::move(errors);
-
-	if (!compilerStack.unhandledSMTLib2Queries().empty())
-		for (string const& query: compilerStack.unhandledSMTLib2Queries())
-			output["auxiliaryInputRequested"]["smtlib2queries"]["0x" + util::keccak256(query).hex()] = query;
-
+	// Optional, so that it can be stopped before the streamed output includes the profile.
+	std::optional<util::ScopedTimer> outputTimer;
+	outputTimer.emplace("JSON output");
 	bool const wildcardMatchesExperimental = false;
 
-	output["sources"] = Json::objectValue;
-	unsigned sourceIndex = 0;
-	if (compilerStack.state() >= CompilerStack::State::Parsed && (!compilerStack.hasError() || _inputsAndSettings.parserErrorRecovery))
-		for (string const& sourceName: compilerStack.sourceNames())
-		{
-			Json::Value sourceResult = Json::objectValue;
-			sourceResult["id"] = sourceIndex++;
-			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
-				sourceResult["ast"] = ASTJsonConverter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			output["sources"][sourceName] = sourceResult;
-		}
+	Json::Value auxiliaryInputRequested;
+	for (string const& query: compilerStack.unhandledSMTLib2Queries())
+		auxiliaryInputRequested["smtlib2queries"]["0x" + util::keccak256(query).hex()] = query;
 
-	Json::Value contractsOutput = Json::objectValue;
+	// Sorted by name, which is also the order of their source indices.
+	vector<string> sourceNames;
+	if (compilerStack.state() >= CompilerStack::State::Parsed && (!compilerStack.hasError() || _inputsAndSettings.parserErrorRecovery))
+		sourceNames = compilerStack.sourceNames();
+	auto sourceOutput = [&](unsigned _sourceIndex) {
+		Json::Value sourceResult = Json::objectValue;
+		sourceResult["id"] = _sourceIndex;
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceNames[_sourceIndex], "", "ast", wildcardMatchesExperimental))
+			sourceResult["ast"] = ASTJsonConverter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceNames[_sourceIndex]));
+		return sourceResult;
+	};
+
+	// Fully qualified names of the contracts by source and contract name.
+	map<string, map<string, string>> contractNames;
 	for (string const& contractName: analysisPerformed ? compilerStack.contractNames() : vector<string>())
 	{
 		size_t colon = contractName.rfind(':');
 		solAssert(colon != string::npos, "");
-		string file = contractName.substr(0, colon);
-		string name = contractName.substr(colon + 1);
-
+		contractNames[contractName.substr(0, colon)][contractName.substr(colon + 1)] = contractName;
+	}
+	auto contractOutput = [&](string const& _file, string const& _name, string const& _contractName) {
 		// ABI, storage layout, documentation and metadata
 		Json::Value contractData(Json::objectValue);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "abi", wildcardMatchesExperimental))
-			contractData["abi"] = compilerStack.contractABI(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "storageLayout", false))
-			contractData["storageLayout"] = compilerStack.storageLayout(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "metadata", wildcardMatchesExperimental))
-			contractData["metadata"] = compilerStack.metadata(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "userdoc", wildcardMatchesExperimental))
-			contractData["userdoc"] = compilerStack.natspecUser(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "devdoc", wildcardMatchesExperimental))
-			contractData["devdoc"] = compilerStack.natspecDev(contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "abi", wildcardMatchesExperimental))
+			contractData["abi"] = compilerStack.contractABI(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "storageLayout", false))
+			contractData["storageLayout"] = compilerStack.storageLayout(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "metadata", wildcardMatchesExperimental))
+			contractData["metadata"] = compilerStack.metadata(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "userdoc", wildcardMatchesExperimental))
+			contractData["userdoc"] = compilerStack.natspecUser(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "devdoc", wildcardMatchesExperimental))
+			contractData["devdoc"] = compilerStack.natspecDev(_contractName);
 
 		// IR
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ir", wildcardMatchesExperimental))
-			contractData["ir"] = compilerStack.yulIR(contractName);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
-			contractData["irOptimized"] = compilerStack.yulIROptimized(contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "ir", wildcardMatchesExperimental))
+			contractData["ir"] = compilerStack.yulIR(_contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "irOptimized", wildcardMatchesExperimental))
+			contractData["irOptimized"] = compilerStack.yulIROptimized(_contractName);
 
 		// Ewasm
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ewasm.wast", wildcardMatchesExperimental))
-			contractData["ewasm"]["wast"] = compilerStack.ewasm(contractName);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ewasm.wasm", wildcardMatchesExperimental))
-			contractData["ewasm"]["wasm"] = compilerStack.ewasmObject(contractName).toHex();
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "ewasm.wast", wildcardMatchesExperimental))
+			contractData["ewasm"]["wast"] = compilerStack.ewasm(_contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "ewasm.wasm", wildcardMatchesExperimental))
+			contractData["ewasm"]["wasm"] = compilerStack.ewasmObject(_contractName).toHex();
 
 		// EVM
 		Json::Value evmData(Json::objectValue);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
-			evmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
-			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
-			evmData["methodIdentifiers"] = compilerStack.methodIdentifiers(contractName);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.gasEstimates", wildcardMatchesExperimental))
-			evmData["gasEstimates"] = compilerStack.gasEstimates(contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.assembly", wildcardMatchesExperimental))
+			evmData["assembly"] = compilerStack.assemblyString(_contractName, sourceList);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.legacyAssembly", wildcardMatchesExperimental))
+			evmData["legacyAssembly"] = compilerStack.assemblyJSON(_contractName);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.methodIdentifiers", wildcardMatchesExperimental))
+			evmData["methodIdentifiers"] = compilerStack.methodIdentifiers(_contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, _file, _name, "evm.gasEstimates", wildcardMatchesExperimental))
+			evmData["gasEstimates"] = compilerStack.gasEstimates(_contractName);
 
 		if (compilationSuccess && isArtifactRequested(
 			_inputsAndSettings.outputSelection,
-			file,
-			name,
+			_file,
+			_name,
 			evmObjectComponents("bytecode"),
 			wildcardMatchesExperimental
 		))
 			evmData["bytecode"] = collectEVMObject(
-				compilerStack.object(contractName),
-				compilerStack.sourceMapping(contractName),
-				compilerStack.generatedSources(contractName),
+				compilerStack.object(_contractName),
+				[&]() { return compilerStack.sourceMapping(_contractName); },
+				[&]() { return compilerStack.generatedSources(_contractName); },
 				false,
 				[&](string const& _element) { return isArtifactRequested(
 					_inputsAndSettings.outputSelection,
-					file,
-					name,
+					_file,
+					_name,
 					"evm.bytecode." + _element,
 					wildcardMatchesExperimental
 				); }
@@ -1224,42 +1249,88 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 
 		if (compilationSuccess && isArtifactRequested(
 			_inputsAndSettings.outputSelection,
-			file,
-			name,
+			_file,
+			_name,
 			evmObjectComponents("deployedBytecode"),
 			wildcardMatchesExperimental
 		))
 			evmData["deployedBytecode"] = collectEVMObject(
-				compilerStack.runtimeObject(contractName),
-				compilerStack.runtimeSourceMapping(contractName),
-				compilerStack.generatedSources(contractName, true),
+				compilerStack.runtimeObject(_contractName),
+				[&]() { return compilerStack.runtimeSourceMapping(_contractName); },
+				[&]() { return compilerStack.generatedSources(_contractName, true); },
 				true,
 				[&](string const& _element) { return isArtifactRequested(
 					_inputsAndSettings.outputSelection,
-					file,
-					name,
+					_file,
+					_name,
 					"evm.deployedBytecode." + _element,
 					wildcardMatchesExperimental
 				); }
 			);
 
 		if (!evmData.empty())
-			contractData["evm"] = evmData;
+			contractData["evm"] = std::move(evmData);
+		return contractData;
+	};
 
-		if (!contractData.empty())
+	if (_stream)
+	{
+		// Members have to be written in the order of their names.
+		_stream->beginObject();
+		if (!auxiliaryInputRequested.isNull())
+			_stream->writeMember("auxiliaryInputRequested", auxiliaryInputRequested);
+		_stream->beginObject("contracts", true);
+		for (auto const& [file, contracts]: contractNames)
 		{
-			if (!contractsOutput.isMember(file))
-				contractsOutput[file] = Json::objectValue;
-			contractsOutput[file][name] = contractData;
+			_stream->beginObject(file, true);
+			for (auto const& [name, contractName]: contracts)
+			{
+				Json::Value contractData = contractOutput(file, name, contractName);
+				if (!contractData.empty())
+					_stream->writeMember(name, contractData);
+			}
+			_stream->endObject();
 		}
+		_stream->endObject();
+		if (errors.size() > 0)
+			_stream->writeMember("errors", errors);
+		outputTimer.reset();
+		if (_inputsAndSettings.profiling)
+			_stream->writeMember("profiling", util::Profiler::toJson(util::Profiler::stop()));
+		_stream->beginObject("sources");
+		for (unsigned sourceIndex = 0; sourceIndex < sourceNames.size(); ++sourceIndex)
+			_stream->writeMember(sourceNames[sourceIndex], sourceOutput(sourceIndex));
+		_stream->endObject();
+		_stream->endObject();
+		return Json::nullValue;
 	}
+
+	Json::Value output = Json::objectValue;
+
+	if (errors.size() > 0)
+		output["errors"] = std::move(errors);
+
+	if (!auxiliaryInputRequested.isNull())
+		output["auxiliaryInputRequested"] = std::move(auxiliaryInputRequested);
+
+	output["sources"] = Json::objectValue;
+	for (unsigned sourceIndex = 0; sourceIndex < sourceNames.size(); ++sourceIndex)
+		output["sources"][sourceNames[sourceIndex]] = sourceOutput(sourceIndex);
+
+	Json::Value contractsOutput = Json::objectValue;
+	for (auto const& [file, contracts]: contractNames)
+		for (auto const& [name, contractName]: contracts)
+		{
+			Json::Value contractData = contractOutput(file, name, contractName);
+			if (!contractData.empty())
+				contractsOutput[file][name] = std::move(contractData);
+		}
 	if (!contractsOutput.empty())
-		output["contracts"] = contractsOutput;
+		output["contracts"] = std::move(contractsOutput);
 
 	return output;
 }
 
-
 Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 {
 	if (_inputsAndSettings.sources.size() != 1)
@@ -1339,8 +1410,8 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 				output["contracts"][sourceName][contractName]["evm"][objectKind] =
 					collectEVMObject(
 						*o.bytecode,
-						o.sourceMappings.get(),
-						Json::arrayValue,
+						[&]() { return o.sourceMappings.get(); },
+						[]() { return Json::Value(Json::arrayValue); },
 						false,
 						[&](string const& _element) { return isArtifactRequested(
 							_inputsAndSettings.outputSelection,
@@ -1362,6 +1433,11 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
+{
+	return compile(_input, nullptr);
+}
+
+Json::Value StandardCompiler::compile(Json::Value const& _input, util::JsonStreamWriter* _stream) noexcept
 {
 	YulStringRepository::reset();
 
@@ -1371,12 +1447,25 @@ Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 		if (std::holds_alternative<Json::Value>(parsed))
 			return std::get<Json::Value>(std::move(parsed));
 		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
-		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
-		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
-		else
+		if (settings.language != "Solidity" && settings.language != "Yul")
 			return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
+
+		// If the profiler is already running, e.g. for the command-line interface, the
+		// phases are part of its report instead.
+		bool const profiling = settings.profiling && !util::Profiler::enabled();
+		settings.profiling = profiling;
+		if (profiling)
+			util::Profiler::start();
+		ScopeGuard stopProfiler{[&]() {
+			if (profiling && util::Profiler::enabled())
+				util::Profiler::stop();
+		}};
+		Json::Value output = settings.language == "Solidity" ?
+			compileSolidity(std::move(settings), _stream) :
+			compileYul(std::move(settings));
+		if (profiling && !output.isNull())
+			output["profiling"] = util::Profiler::toJson(util::Profiler::stop());
+		return output;
 	}
 	catch (Json::LogicError const& _exception)
 	{
@@ -1397,29 +1486,45 @@ Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 }
 
 string StandardCompiler::compile(string const& _input) noexcept
+{
+	ostringstream output;
+	compile(_input, output);
+	return output.str();
+}
+
+void StandardCompiler::compile(string const& _input, ostream& _output) noexcept
 {
 	Json::Value input;
 	string errors;
 	try
 	{
 		if (!util::jsonParseStrict(_input, input, &errors))
-			return util::jsonCompactPrint(formatFatalError("JSONError", errors));
+		{
+			_output << util::jsonCompactPrint(formatFatalError("JSONError", errors));
+			return;
+		}
 	}
 	catch (...)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		return;
 	}
 
-	// cout << "Input: " << input.toStyledString() << endl;
-	Json::Value output = compile(input);
-	// cout << "Output: " << output.toStyledString() << endl;
+	// The output is only passed on once it is complete, so that an error that occurs after
+	// parts of it have been written still results in a single well-formed document.
+	ostringstream buffer;
+	util::JsonStreamWriter writer(buffer, false);
+	Json::Value output = compile(input, &writer);
 
 	try
 	{
-		return util::jsonCompactPrint(output);
+		if (output.isNull())
+			_output << buffer.rdbuf();
+		else
+			_output << util::jsonCompactPrint(output);
 	}
 	catch (...)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
 	}
 }
@@ -25,7 +25,10 @@
 
 #include <libsolidity/interface/CompilerStack.h>
 
+#include <libsolutil/JSON.h>
+
 #include <optional>
+#include <ostream>
 #include <utility>
 #include <variant>
 
@@ -57,6 +60,11 @@ public:
 	/// Parses input as JSON and peforms the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Same as the above, but writes the output to @a _output. The outputs of the individual
+	/// contracts and sources are serialized as soon as they have been produced, so that the
+	/// output as a whole is never held in memory as a JSON tree. The output is written to
+	/// @a _output only once it is complete; on failure, only the errors are written.
+	void compile(std::string const& _input, std::ostream& _output) noexcept;
 
 private:
 	struct InputsAndSettings
@@ -77,13 +85,22 @@ private:
 		Json::Value outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		/// If set, the time and memory spent in the phases of the compilation are reported.
+		bool profiling = false;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
-	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
+	/// Performs the compilation of @a _input. If @a _stream is given, the output is written to it
+	/// and @returns null. If an error occurs, @returns the complete error output instead and
+	/// anything already written to @a _stream has to be discarded by the caller.
+	Json::Value compile(Json::Value const& _input, util::JsonStreamWriter* _stream) noexcept;
+
+	/// Compiles Solidity sources. If @a _stream is given, the output is written to it and
+	/// @returns null, unless the compilation ended with a fatal error before any output was written.
+	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _stream = nullptr);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
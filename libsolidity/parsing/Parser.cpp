@@ -66,7 +66,9 @@ public:
 		solAssert(m_location.source, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		return m_parser.registerNode(
+			make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...)
+		);
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -144,6 +146,13 @@ ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner)
 	}
 }
 
+void Parser::shiftNodeIDs(int64_t _offset)
+{
+	for (weak_ptr<ASTNode> const& weakNode: m_createdNodes)
+		if (shared_ptr<ASTNode> node = weakNode.lock())
+			node->m_id = static_cast<size_t>(node->id() + _offset);
+}
+
 void Parser::parsePragmaVersion(SourceLocation const& _location, vector<Token> const& _tokens, vector<string> const& _literals)
 {
 	SemVerMatchExpressionParser parser(_tokens, _literals);
@@ -1300,7 +1309,7 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = block->location.end;
-	return make_shared<InlineAssembly>(nextID(), location, _docString, dialect, block);
+	return registerNode(make_shared<InlineAssembly>(nextID(), location, _docString, dialect, block));
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -49,6 +49,13 @@ public:
 
 	ASTPointer<SourceUnit> parse(std::shared_ptr<langutil::Scanner> const& _scanner);
 
+	/// Adds @a _offset to the IDs of all AST nodes created by this parser. This allows
+	/// source units to be parsed by separate parsers and still receive the IDs they would
+	/// have received when parsed in sequence by a single parser.
+	void shiftNodeIDs(int64_t _offset);
+	/// @returns the number of AST node IDs handed out by this parser.
+	int64_t nodeIDCount() const { return m_currentNodeID; }
+
 private:
 	class ASTNodeFactory;
 
@@ -187,6 +194,13 @@ private:
 
 	/// Returns the next AST node ID
 	int64_t nextID() { return ++m_currentNodeID; }
+	/// Registers a newly created node so that its ID can be shifted later.
+	template <class NodeType>
+	ASTPointer<NodeType> registerNode(ASTPointer<NodeType> _node)
+	{
+		m_createdNodes.emplace_back(_node);
+		return _node;
+	}
 
 	std::pair<LookAheadInfo, IndexAccessedPath> tryParseIndexAccessedPath();
 	/// Performs limited look-ahead to distinguish between variable declaration and expression statement.
@@ -216,6 +230,8 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// All nodes created by this parser, used by shiftNodeIDs().
+	std::vector<std::weak_ptr<ASTNode>> m_createdNodes;
 };
 
 }
@@ -29,6 +29,7 @@
 #include <sstream>
 #include <map>
 #include <memory>
+#include <string_view>
 
 using namespace std;
 
@@ -88,6 +89,311 @@ bool parse(Json::CharReaderBuilder& _builder, string const& _input, Json::Value&
 	return reader->parse(_input.c_str(), _input.c_str() + _input.length(), &_json, _errs);
 }
 
+/// Parser for JSON documents that conform to the standard, which is faster than the
+/// jsoncpp reader. It only accepts documents that the jsoncpp reader in strict mode accepts as well
+/// and produces the same values for them. Everything else, including all documents with errors,
+/// comments or numbers that are not integers, is rejected and left to the jsoncpp reader,
+/// which then also produces the error messages.
+class FastStrictParser
+{
+public:
+	explicit FastStrictParser(string const& _input):
+		m_position(_input.data()),
+		m_end(_input.data() + _input.size())
+	{}
+
+	/// @returns true and stores the document in @a _json if it was accepted.
+	bool parse(Json::Value& _json)
+	{
+		skipWhitespace();
+		// Like the jsoncpp reader in strict mode, only allow objects and arrays at the top level.
+		if (m_position == m_end || (*m_position != '{' && *m_position != '['))
+			return false;
+		if (!parseValue(_json, 0))
+			return false;
+		skipWhitespace();
+		return m_position == m_end;
+	}
+
+private:
+	/// Maximum nesting depth, which is below the stack limit of the jsoncpp reader in strict mode.
+	static size_t constexpr c_maxDepth = 900;
+
+	bool parseValue(Json::Value& _json, size_t _depth)
+	{
+		if (m_position == m_end || _depth > c_maxDepth)
+			return false;
+		switch (*m_position)
+		{
+		case '{':
+			return parseObject(_json, _depth);
+		case '[':
+			return parseArray(_json, _depth);
+		case '"':
+		{
+			char const* begin = m_position + 1;
+			if (!parseString(m_buffer))
+				return false;
+			// Avoid copying the value if it does not contain escape sequences.
+			if (m_position - 1 - begin == static_cast<ptrdiff_t>(m_buffer.size()))
+				_json = Json::Value(begin, m_position - 1);
+			else
+				_json = Json::Value(m_buffer);
+			return true;
+		}
+		case 't':
+			return parseLiteral("true", Json::Value(true), _json);
+		case 'f':
+			return parseLiteral("false", Json::Value(false), _json);
+		case 'n':
+			return parseLiteral("null", Json::Value(), _json);
+		default:
+			return parseInteger(_json);
+		}
+	}
+
+	bool parseObject(Json::Value& _json, size_t _depth)
+	{
+		++m_position;
+		_json = Json::Value(Json::objectValue);
+		skipWhitespace();
+		if (m_position != m_end && *m_position == '}')
+		{
+			++m_position;
+			return true;
+		}
+		string key;
+		while (true)
+		{
+			if (m_position == m_end || *m_position != '"' || !parseString(key))
+				return false;
+			skipWhitespace();
+			if (m_position == m_end || *m_position != ':')
+				return false;
+			++m_position;
+			skipWhitespace();
+			Json::ArrayIndex size = _json.size();
+			Json::Value& member = _json[key];
+			// Duplicate keys are rejected in strict mode.
+			if (_json.size() == size || !parseValue(member, _depth + 1))
+				return false;
+			skipWhitespace();
+			if (m_position == m_end)
+				return false;
+			if (*m_position == '}')
+			{
+				++m_position;
+				return true;
+			}
+			if (*m_position != ',')
+				return false;
+			++m_position;
+			skipWhitespace();
+		}
+	}
+
+	bool parseArray(Json::Value& _json, size_t _depth)
+	{
+		++m_position;
+		_json = Json::Value(Json::arrayValue);
+		skipWhitespace();
+		if (m_position != m_end && *m_position == ']')
+		{
+			++m_position;
+			return true;
+		}
+		for (Json::ArrayIndex index = 0; ; ++index)
+		{
+			if (!parseValue(_json[index], _depth + 1))
+				return false;
+			skipWhitespace();
+			if (m_position == m_end)
+				return false;
+			if (*m_position == ']')
+			{
+				++m_position;
+				return true;
+			}
+			if (*m_position != ',')
+				return false;
+			++m_position;
+			skipWhitespace();
+		}
+	}
+
+	/// Parses the string literal at the current position and stores its value in @a _string.
+	bool parseString(string& _string)
+	{
+		++m_position;
+		_string.clear();
+		char const* chunk = m_position;
+		while (m_position != m_end)
+		{
+			unsigned char c = static_cast<unsigned char>(*m_position);
+			if (c == '"')
+			{
+				_string.append(chunk, m_position);
+				++m_position;
+				return true;
+			}
+			else if (c < 0x20)
+				return false;
+			else if (c != '\\')
+			{
+				++m_position;
+				continue;
+			}
+
+			_string.append(chunk, m_position);
+			++m_position;
+			if (m_position == m_end)
+				return false;
+			switch (*m_position++)
+			{
+			case '"': _string += '"'; break;
+			case '\\': _string += '\\'; break;
+			case '/': _string += '/'; break;
+			case 'b': _string += '\b'; break;
+			case 'f': _string += '\f'; break;
+			case 'n': _string += '\n'; break;
+			case 'r': _string += '\r'; break;
+			case 't': _string += '\t'; break;
+			case 'u':
+			{
+				unsigned codePoint = 0;
+				if (!parseHex4(codePoint))
+					return false;
+				if (0xD800 <= codePoint && codePoint < 0xDC00)
+				{
+					unsigned lowSurrogate = 0;
+					if (
+						m_end - m_position < 2 ||
+						m_position[0] != '\\' ||
+						m_position[1] != 'u'
+					)
+						return false;
+					m_position += 2;
+					if (!parseHex4(lowSurrogate) || lowSurrogate < 0xDC00 || lowSurrogate >= 0xE000)
+						return false;
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+				}
+				else if (0xDC00 <= codePoint && codePoint < 0xE000)
+					return false;
+				appendUTF8(_string, codePoint);
+				break;
+			}
+			default:
+				return false;
+			}
+			chunk = m_position;
+		}
+		return false;
+	}
+
+	bool parseHex4(unsigned& _value)
+	{
+		if (m_end - m_position < 4)
+			return false;
+		for (size_t i = 0; i < 4; ++i)
+		{
+			char c = *m_position++;
+			_value <<= 4;
+			if ('0' <= c && c <= '9')
+				_value += static_cast<unsigned>(c - '0');
+			else if ('a' <= c && c <= 'f')
+				_value += static_cast<unsigned>(c - 'a' + 10);
+			else if ('A' <= c && c <= 'F')
+				_value += static_cast<unsigned>(c - 'A' + 10);
+			else
+				return false;
+		}
+		return true;
+	}
+
+	static void appendUTF8(string& _string, unsigned _codePoint)
+	{
+		if (_codePoint < 0x80)
+			_string += static_cast<char>(_codePoint);
+		else if (_codePoint < 0x800)
+		{
+			_string += static_cast<char>(0xC0 | (_codePoint >> 6));
+			_string += static_cast<char>(0x80 | (_codePoint & 0x3F));
+		}
+		else if (_codePoint < 0x10000)
+		{
+			_string += static_cast<char>(0xE0 | (_codePoint >> 12));
+			_string += static_cast<char>(0x80 | ((_codePoint >> 6) & 0x3F));
+			_string += static_cast<char>(0x80 | (_codePoint & 0x3F));
+		}
+		else
+		{
+			_string += static_cast<char>(0xF0 | (_codePoint >> 18));
+			_string += static_cast<char>(0x80 | ((_codePoint >> 12) & 0x3F));
+			_string += static_cast<char>(0x80 | ((_codePoint >> 6) & 0x3F));
+			_string += static_cast<char>(0x80 | (_codePoint & 0x3F));
+		}
+	}
+
+	/// Parses an integer in the same way as the jsoncpp reader. Numbers that do not fit into
+	/// 64 bits are rejected, since jsoncpp turns them into floating point values.
+	bool parseInteger(Json::Value& _json)
+	{
+		bool const negative = *m_position == '-';
+		if (negative)
+			++m_position;
+		char const* digits = m_position;
+		while (m_position != m_end && '0' <= *m_position && *m_position <= '9')
+			++m_position;
+		if (
+			m_position == digits ||
+			(*digits == '0' && m_position - digits > 1) ||
+			(m_position != m_end && (*m_position == '.' || *m_position == 'e' || *m_position == 'E'))
+		)
+			return false;
+
+		Json::LargestUInt const maxValue =
+			negative ? Json::LargestUInt(Json::Value::minLargestInt) : Json::Value::maxLargestUInt;
+		Json::LargestUInt value = 0;
+		for (char const* digit = digits; digit != m_position; ++digit)
+		{
+			auto digitValue = static_cast<Json::LargestUInt>(*digit - '0');
+			if (value > (maxValue - digitValue) / 10)
+				return false;
+			value = value * 10 + digitValue;
+		}
+
+		if (negative && value == maxValue)
+			_json = Json::Value::minLargestInt;
+		else if (negative)
+			_json = -Json::LargestInt(value);
+		else if (value <= Json::LargestUInt(Json::Value::maxLargestInt))
+			_json = Json::LargestInt(value);
+		else
+			_json = value;
+		return true;
+	}
+
+	bool parseLiteral(string_view _literal, Json::Value _value, Json::Value& _json)
+	{
+		if (static_cast<size_t>(m_end - m_position) < _literal.size() || string_view(m_position, _literal.size()) != _literal)
+			return false;
+		m_position += _literal.size();
+		_json = std::move(_value);
+		return true;
+	}
+
+	void skipWhitespace()
+	{
+		while (m_position != m_end && (*m_position == ' ' || *m_position == '\t' || *m_position == '\n' || *m_position == '\r'))
+			++m_position;
+	}
+
+	char const* m_position;
+	char const* m_end;
+	/// Buffer for the values of string literals, reused to avoid allocations.
+	string m_buffer;
+};
+
 /// Takes a JSON value (@ _json) and removes all its members with value 'null' recursively.
 void removeNullMembersHelper(Json::Value& _json)
 {
@@ -131,8 +437,87 @@ string jsonCompactPrint(Json::Value const& _input)
 
 bool jsonParseStrict(string const& _input, Json::Value& _json, string* _errs /* = nullptr */)
 {
+	if (FastStrictParser(_input).parse(_json))
+	{
+		if (_errs)
+			_errs->clear();
+		return true;
+	}
 	static StrictModeCharReaderBuilder readerBuilder;
 	return parse(readerBuilder, _input, _json, _errs);
 }
 
+void JsonStreamWriter::beginObject()
+{
+	m_objects.emplace_back();
+}
+
+void JsonStreamWriter::beginObject(string const& _name, bool _omitIfEmpty)
+{
+	m_objects.push_back({_name, _omitIfEmpty, false, false});
+}
+
+void JsonStreamWriter::endObject()
+{
+	Object object = move(m_objects.back());
+	m_objects.pop_back();
+	if (!object.opened)
+	{
+		if (object.omitIfEmpty)
+			return;
+		if (!m_objects.empty())
+		{
+			openObjects();
+			writeMemberName(m_objects.size() - 1, object.name, false);
+		}
+		m_stream << "{}";
+		return;
+	}
+	if (m_pretty)
+		m_stream << "\n" << indentation(m_objects.size());
+	m_stream << "}";
+}
+
+void JsonStreamWriter::writeMember(string const& _name, Json::Value const& _value)
+{
+	openObjects();
+	string value = m_pretty ? jsonPrettyPrint(_value) : jsonCompactPrint(_value);
+	// Only non-empty objects and arrays span multiple lines, since line breaks in strings are escaped.
+	bool multiline = value.find('\n') != string::npos;
+	writeMemberName(m_objects.size() - 1, _name, multiline);
+	if (multiline)
+		boost::replace_all(value, "\n", "\n" + indentation(m_objects.size()));
+	m_stream << value;
+}
+
+void JsonStreamWriter::openObjects()
+{
+	for (size_t i = 0; i < m_objects.size(); ++i)
+		if (!m_objects[i].opened)
+		{
+			if (i > 0)
+				writeMemberName(i - 1, m_objects[i].name, true);
+			m_stream << "{";
+			m_objects[i].opened = true;
+		}
+}
+
+void JsonStreamWriter::writeMemberName(size_t _object, string const& _name, bool _multiline)
+{
+	if (m_objects[_object].hasMembers)
+		m_stream << ",";
+	m_objects[_object].hasMembers = true;
+	if (m_pretty)
+		m_stream << "\n" << indentation(_object + 1);
+	m_stream << jsonCompactPrint(Json::Value(_name)) << ":";
+	// Like jsonPrettyPrint, do not leave a space at the end of the line.
+	if (m_pretty)
+		m_stream << (_multiline ? "\n" + indentation(_object + 1) : " ");
+}
+
+string JsonStreamWriter::indentation(size_t _depth) const
+{
+	return string(2 * _depth, ' ');
+}
+
 } // namespace solidity::util
@@ -25,7 +25,9 @@
 
 #include <json/json.h>
 
+#include <ostream>
 #include <string>
+#include <vector>
 
 namespace solidity::util {
 
@@ -45,4 +47,50 @@ std::string jsonCompactPrint(Json::Value const& _input);
 /// \return \c true if the document was successfully parsed, \c false if an error occurred.
 bool jsonParseStrict(std::string const& _input, Json::Value& _json, std::string* _errs = nullptr);
 
+/**
+ * Writes a JSON object to a stream piece by piece, so that large documents do not have to be
+ * held in memory as a whole. If the members of every object are written in the order of their
+ * names, the output is identical to that of jsonCompactPrint or jsonPrettyPrint for the
+ * whole document.
+ */
+class JsonStreamWriter
+{
+public:
+	JsonStreamWriter(std::ostream& _stream, bool _pretty): m_stream(_stream), m_pretty(_pretty) {}
+
+	/// Starts the object that forms the document.
+	void beginObject();
+	/// Starts an object as the value of the member @a _name of the current object.
+	/// If @a _omitIfEmpty is true and no members are added to it, the member is not written at all.
+	void beginObject(std::string const& _name, bool _omitIfEmpty = false);
+	/// Ends the current object.
+	void endObject();
+	/// Writes the member @a _name with the value @a _value to the current object.
+	void writeMember(std::string const& _name, Json::Value const& _value);
+
+	/// @returns the number of objects that have been started but not yet ended.
+	size_t depth() const { return m_objects.size(); }
+
+private:
+	struct Object
+	{
+		std::string name;
+		bool omitIfEmpty = false;
+		/// True if the opening brace has been written, which happens when the first member is added.
+		bool opened = false;
+		bool hasMembers = false;
+	};
+
+	/// Writes the opening braces of all started objects that have not been written yet.
+	void openObjects();
+	/// Writes the separator and the name of a member of the object at position @a _object,
+	/// whose value is written on the same line unless @a _multiline is set.
+	void writeMemberName(size_t _object, std::string const& _name, bool _multiline);
+	std::string indentation(size_t _depth) const;
+
+	std::ostream& m_stream;
+	bool m_pretty = false;
+	std::vector<Object> m_objects;
+};
+
 }
@@ -0,0 +1,72 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers for running independent pieces of work concurrently.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace solidity::util
+{
+
+/// @returns the number of threads to use for concurrent work if the user did not request
+/// a specific number. This is always one on platforms without thread support.
+size_t defaultThreadCount();
+
+/// Calls @a _function for every index in the range [0, @a _count) using up to @a _threadCount
+/// threads, including the calling thread. The order in which the indices are processed is
+/// unspecified, so @a _function has to store its results by index.
+/// If calls throw, the exception of the call with the lowest index is rethrown in the calling
+/// thread after all calls have finished.
+template <typename Function>
+void parallelFor(size_t _count, size_t _threadCount, Function const& _function)
+{
+	std::vector<std::exception_ptr> exceptions(_count);
+	std::atomic<size_t> nextIndex{0};
+	auto work = [&]() {
+		for (size_t index = nextIndex++; index < _count; index = nextIndex++)
+			try
+			{
+				_function(index);
+			}
+			catch (...)
+			{
+				exceptions[index] = std::current_exception();
+			}
+	};
+
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < std::min(_threadCount, _count); ++i)
+		workers.emplace_back(work);
+	work();
+	for (std::thread& worker: workers)
+		worker.join();
+
+	for (std::exception_ptr const& exception: exceptions)
+		if (exception)
+			std::rethrow_exception(exception);
+}
+
+}
@@ -0,0 +1,257 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Profiler.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+struct Profiler::Node
+{
+	string name;
+	Node* parent = nullptr;
+	chrono::nanoseconds duration{0};
+	size_t count = 0;
+	size_t peakMemoryIncrease = 0;
+	vector<unique_ptr<Node>> children;
+
+	/// @returns the sub-phase called @a _name, which is created if it does not exist yet.
+	Node& child(string_view _name)
+	{
+		for (auto const& node: children)
+			if (node->name == _name)
+				return *node;
+		children.emplace_back(make_unique<Node>());
+		children.back()->name = string(_name);
+		children.back()->parent = this;
+		return *children.back();
+	}
+
+	Phase toPhase() const
+	{
+		Phase phase{name, duration, count, peakMemoryIncrease, {}};
+		for (auto const& node: children)
+			phase.children.emplace_back(node->toPhase());
+		return phase;
+	}
+};
+
+struct Profiler::State
+{
+	mutex guard;
+	Node root;
+	/// Incremented by every call to @a start, so that phases of earlier recordings are ignored.
+	size_t generation = 0;
+	chrono::steady_clock::time_point start;
+	size_t peakMemoryAtStart = 0;
+	bool recordTrace = false;
+	vector<TraceEvent> traceEvents;
+	/// Numbers of the threads in the trace events.
+	map<thread::id, size_t> threads;
+};
+
+atomic<bool> Profiler::s_enabled{false};
+thread_local Profiler::Node* Profiler::s_activeNode = nullptr;
+thread_local size_t Profiler::s_activeGeneration = 0;
+
+Profiler::State& Profiler::state()
+{
+	static State state;
+	return state;
+}
+
+void Profiler::start(bool _recordTrace)
+{
+	State& profilerState = state();
+	lock_guard<mutex> lock(profilerState.guard);
+	profilerState.root = Node{};
+	++profilerState.generation;
+	profilerState.recordTrace = _recordTrace;
+	profilerState.traceEvents.clear();
+	profilerState.threads = {{this_thread::get_id(), 1}};
+	profilerState.peakMemoryAtStart = peakMemoryUsage();
+	profilerState.start = chrono::steady_clock::now();
+	s_enabled = true;
+}
+
+Profiler::Phase Profiler::stop()
+{
+	State& profilerState = state();
+	lock_guard<mutex> lock(profilerState.guard);
+	s_enabled = false;
+	profilerState.root.duration = chrono::steady_clock::now() - profilerState.start;
+	profilerState.root.count = 1;
+	profilerState.root.peakMemoryIncrease = peakMemoryUsage() - profilerState.peakMemoryAtStart;
+	return profilerState.root.toPhase();
+}
+
+vector<Profiler::TraceEvent> Profiler::traceEvents()
+{
+	State& profilerState = state();
+	lock_guard<mutex> lock(profilerState.guard);
+	return profilerState.traceEvents;
+}
+
+Profiler::Node* Profiler::enter(string_view _name, size_t& _generation)
+{
+	State& profilerState = state();
+	lock_guard<mutex> lock(profilerState.guard);
+	if (s_activeGeneration != profilerState.generation)
+	{
+		s_activeNode = &profilerState.root;
+		s_activeGeneration = profilerState.generation;
+	}
+	_generation = profilerState.generation;
+	s_activeNode = &s_activeNode->child(_name);
+	return s_activeNode;
+}
+
+void Profiler::leave(
+	Node* _node,
+	size_t _generation,
+	chrono::steady_clock::time_point _start,
+	size_t _peakMemoryAtStart
+)
+{
+	chrono::nanoseconds duration = chrono::steady_clock::now() - _start;
+	size_t peakMemory = peakMemoryUsage();
+
+	State& profilerState = state();
+	lock_guard<mutex> lock(profilerState.guard);
+	if (_generation != profilerState.generation)
+		return;
+	_node->duration += duration;
+	++_node->count;
+	_node->peakMemoryIncrease += peakMemory - _peakMemoryAtStart;
+	s_activeNode = _node->parent;
+
+	if (profilerState.recordTrace)
+	{
+		size_t thread = profilerState.threads.emplace(
+			this_thread::get_id(),
+			profilerState.threads.size() + 1
+		).first->second;
+		profilerState.traceEvents.push_back({_node->name, _start - profilerState.start, duration, thread});
+	}
+}
+
+string Profiler::formatTable(Phase const& _root)
+{
+	struct Row
+	{
+		string name;
+		Phase const* phase;
+	};
+	vector<Row> rows;
+	auto addRows = [&](auto&& _self, Phase const& _phase, size_t _depth) -> void {
+		rows.push_back({string(2 * _depth, ' ') + (_phase.name.empty() ? "total" : _phase.name), &_phase});
+		for (Phase const& child: _phase.children)
+			_self(_self, child, _depth + 1);
+	};
+	addRows(addRows, _root, 0);
+
+	size_t nameWidth = 5;
+	for (Row const& row: rows)
+		nameWidth = max(nameWidth, row.name.size());
+
+	double totalMilliseconds = chrono::duration<double, milli>(_root.duration).count();
+	ostringstream table;
+	table << fixed << left << setw(static_cast<int>(nameWidth)) << "Phase" << right;
+	table << setw(14) << "Time (ms)" << setw(9) << "Share" << setw(9) << "Calls" << setw(16) << "Memory (KiB)" << "\n";
+	for (Row const& row: rows)
+	{
+		double milliseconds = chrono::duration<double, milli>(row.phase->duration).count();
+		table << left << setw(static_cast<int>(nameWidth)) << row.name << right;
+		table << setw(14) << setprecision(3) << milliseconds;
+		table << setw(8) << setprecision(1) << (totalMilliseconds > 0 ? 100 * milliseconds / totalMilliseconds : 0.0) << "%";
+		table << setw(9) << row.phase->count;
+		table << setw(16) << row.phase->peakMemoryIncrease / 1024 << "\n";
+	}
+	return table.str();
+}
+
+Json::Value Profiler::toJson(Phase const& _root)
+{
+	Json::Value json{Json::objectValue};
+	json["name"] = _root.name;
+	json["durationMicroseconds"] = Json::UInt64(chrono::duration_cast<chrono::microseconds>(_root.duration).count());
+	json["calls"] = Json::UInt64(_root.count);
+	json["peakMemoryIncrease"] = Json::UInt64(_root.peakMemoryIncrease);
+	if (!_root.children.empty())
+	{
+		json["children"] = Json::arrayValue;
+		for (Phase const& child: _root.children)
+			json["children"].append(toJson(child));
+	}
+	return json;
+}
+
+Json::Value Profiler::toTraceJson(vector<TraceEvent> const& _events)
+{
+	auto microseconds = [](chrono::nanoseconds _duration) {
+		return chrono::duration<double, micro>(_duration).count();
+	};
+
+	Json::Value json{Json::objectValue};
+	json["displayTimeUnit"] = "ms";
+	json["traceEvents"] = Json::arrayValue;
+	for (TraceEvent const& event: _events)
+	{
+		// "Complete" events, which describe a whole run of a phase.
+		Json::Value traceEvent{Json::objectValue};
+		traceEvent["name"] = event.name;
+		traceEvent["ph"] = "X";
+		traceEvent["ts"] = microseconds(event.start);
+		traceEvent["dur"] = microseconds(event.duration);
+		traceEvent["pid"] = 1;
+		traceEvent["tid"] = Json::UInt64(event.thread);
+		json["traceEvents"].append(move(traceEvent));
+	}
+	return json;
+}
+
+size_t Profiler::peakMemoryUsage()
+{
+#if defined(__unix__) || defined(__APPLE__)
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0 || usage.ru_maxrss < 0)
+		return 0;
+#if defined(__APPLE__)
+	// Reported in bytes.
+	return static_cast<size_t>(usage.ru_maxrss);
+#else
+	// Reported in kilobytes.
+	return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+	return 0;
+#endif
+}
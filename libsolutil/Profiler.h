@@ -0,0 +1,154 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Measurement of the time and memory spent in the phases of the compilation.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Process-wide recorder of the wall-clock time spent in and the memory used by named phases
+ * of the compilation. Phases are measured by ScopedTimer objects, which do nothing unless
+ * the profiler has been started.
+ *
+ * Phases form a tree: a phase entered while another one is active on the same thread is
+ * recorded as its sub-phase. Phases with the same name and parent are merged, so that e.g.
+ * an optimiser step that runs many times shows up once, with its total time.
+ * Phases entered on a thread without an active phase are sub-phases of the root.
+ *
+ * Optionally, every single run of a phase is also recorded as a trace event, which can be
+ * exported in the trace event format of the Chrome trace viewer.
+ */
+class Profiler
+{
+public:
+	/// Time spent in and memory used by one phase and its sub-phases.
+	struct Phase
+	{
+		std::string name;
+		/// Total wall-clock time spent in the phase.
+		std::chrono::nanoseconds duration{0};
+		/// Number of times the phase was entered.
+		size_t count = 0;
+		/// Total growth of the peak memory usage of the process while in the phase, in bytes.
+		size_t peakMemoryIncrease = 0;
+		/// Sub-phases in the order in which they were first entered.
+		std::vector<Phase> children;
+	};
+
+	/// A single run of a phase.
+	struct TraceEvent
+	{
+		std::string name;
+		/// Time from the start of the recording to the start of the run.
+		std::chrono::nanoseconds start{0};
+		std::chrono::nanoseconds duration{0};
+		/// Number of the thread the phase ran on, starting at one for the thread that started
+		/// the recording.
+		size_t thread = 0;
+	};
+
+	/// Discards earlier measurements and starts recording. If @a _recordTrace is true, every
+	/// run of a phase is recorded as a trace event in addition.
+	static void start(bool _recordTrace = false);
+	/// Stops recording and @returns the recorded phases as the sub-phases of an unnamed phase
+	/// that covers the whole time since the call to @a start.
+	static Phase stop();
+	/// @returns the trace events of the last recording in the order in which the runs ended.
+	static std::vector<TraceEvent> traceEvents();
+	static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+	/// @returns a human-readable table of @a _root and all its sub-phases.
+	static std::string formatTable(Phase const& _root);
+	/// @returns the JSON representation of @a _root and all its sub-phases.
+	static Json::Value toJson(Phase const& _root);
+	/// @returns @a _events in the JSON trace event format understood by the Chrome trace viewer.
+	static Json::Value toTraceJson(std::vector<TraceEvent> const& _events);
+
+	/// @returns the peak memory usage of the process so far in bytes, or zero if it cannot be
+	/// determined on this platform.
+	static size_t peakMemoryUsage();
+
+private:
+	friend class ScopedTimer;
+	struct Node;
+	struct State;
+
+	static State& state();
+
+	/// Enters the phase @a _name as a sub-phase of the active phase of the calling thread.
+	static Node* enter(std::string_view _name, size_t& _generation);
+	/// Records the end of a phase entered by @a enter.
+	static void leave(
+		Node* _node,
+		size_t _generation,
+		std::chrono::steady_clock::time_point _start,
+		size_t _peakMemoryAtStart
+	);
+
+	static std::atomic<bool> s_enabled;
+	/// Active phase of the current thread and the recording it belongs to.
+	static thread_local Node* s_activeNode;
+	static thread_local size_t s_activeGeneration;
+};
+
+/**
+ * Records the time from its construction to its destruction as a phase of the given name,
+ * if the profiler is running.
+ */
+class ScopedTimer
+{
+public:
+	explicit ScopedTimer(std::string_view _name)
+	{
+		if (Profiler::enabled())
+		{
+			m_node = Profiler::enter(_name, m_generation);
+			m_peakMemoryAtStart = Profiler::peakMemoryUsage();
+			m_start = std::chrono::steady_clock::now();
+		}
+	}
+	~ScopedTimer()
+	{
+		if (m_node)
+			Profiler::leave(m_node, m_generation, m_start, m_peakMemoryAtStart);
+	}
+
+	ScopedTimer(ScopedTimer const&) = delete;
+	ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+private:
+	Profiler::Node* m_node = nullptr;
+	size_t m_generation = 0;
+	std::chrono::steady_clock::time_point m_start;
+	size_t m_peakMemoryAtStart = 0;
+};
+
+}
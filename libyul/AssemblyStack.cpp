@@ -44,6 +44,7 @@
 
 #include <libevmasm/Assembly.h>
 #include <liblangutil/Scanner.h>
+#include <libsolutil/Profiler.h>
 #include <optional>
 
 using namespace std;
@@ -80,6 +81,7 @@ Scanner const& AssemblyStack::scanner() const
 
 bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string const& _source)
 {
+	util::ScopedTimer timer{"Yul parsing and analysis"};
 	m_errors.clear();
 	m_analysisSuccessful = false;
 	m_scanner = make_shared<Scanner>(CharStream(_source, _sourceName));
@@ -229,7 +231,10 @@ std::pair<MachineAssemblyObject, MachineAssemblyObject> AssemblyStack::assembleW
 
 	evmasm::Assembly assembly;
 	EthAssemblyAdapter adapter(assembly);
-	compileEVM(adapter, m_optimiserSettings.optimizeStackAllocation);
+	{
+		util::ScopedTimer timer{"EVM code transform"};
+		compileEVM(adapter, m_optimiserSettings.optimizeStackAllocation);
+	}
 
 	MachineAssemblyObject creationObject;
 	creationObject.bytecode = make_shared<evmasm::LinkerObject>(assembly.assemble());
@@ -21,8 +21,10 @@
 
 #pragma once
 
+#include <array>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <functional>
@@ -33,7 +35,11 @@ namespace solidity::yul
 /// Repository for YulStrings.
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
-/// non-deterministic) and a deterministic string hash.
+/// non-deterministic), a deterministic string hash and a pointer to the string data.
+/// Insertions are synchronised, so YulStrings can be created from several threads. The strings are
+/// distributed over independently locked shards by their hash, so that threads rarely wait for
+/// each other. The string data is never moved, so reading it through a handle does not need
+/// synchronisation.
 class YulStringRepository
 {
 public:
@@ -41,6 +47,7 @@ public:
 	{
 		size_t id;
 		std::uint64_t hash;
+		std::string const* string;
 	};
 
 	static YulStringRepository& instance()
@@ -52,19 +59,29 @@ public:
 	Handle stringToHandle(std::string const& _string)
 	{
 		if (_string.empty())
-			return { 0, emptyHash() };
+			return { 0, emptyHash(), emptyString() };
 		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
+		size_t shardIndex = shardOf(h);
+		Shard& shard = m_shards[shardIndex];
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		auto range = shard.hashToIndex.equal_range(h);
 		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
+			if (*shard.strings[it->second] == _string)
+				return Handle{toID(shardIndex, it->second), h, shard.strings[it->second].get()};
+		shard.strings.emplace_back(std::make_shared<std::string>(_string));
+		size_t index = shard.strings.size() - 1;
+		shard.hashToIndex.emplace_hint(range.second, std::make_pair(h, index));
 
-		return Handle{id, h};
+		return Handle{toID(shardIndex, index), h, shard.strings.back().get()};
+	}
+	std::string const& idToString(size_t _id) const
+	{
+		if (_id == 0)
+			return *emptyString();
+		Shard const& shard = m_shards[(_id - 1) % c_shardCount];
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		return *shard.strings.at((_id - 1) / c_shardCount);
 	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
 
 	static std::uint64_t hash(std::string const& v)
 	{
@@ -79,6 +96,12 @@ public:
 		return hash;
 	}
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
+	/// @returns the string data of all empty YulStrings, which outlives any reset.
+	static std::string const* emptyString()
+	{
+		static std::string const empty;
+		return &empty;
+	}
 	/// Clear the repository.
 	/// Use with care - there cannot be any dangling YulString references.
 	/// If references need to be cleared manually, register the callback via
@@ -87,7 +110,13 @@ public:
 	{
 		for (auto const& cb: resetCallbacks())
 			cb();
-		instance() = YulStringRepository{};
+		YulStringRepository& repository = instance();
+		for (Shard& shard: repository.m_shards)
+		{
+			std::lock_guard<std::mutex> lock(shard.mutex);
+			shard.strings.clear();
+			shard.hashToIndex.clear();
+		}
 	}
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
@@ -100,11 +129,29 @@ public:
 	};
 
 private:
+	/// Strings with hashes that map to the same shard, which are numbered by their index in @a strings.
+	struct Shard
+	{
+		std::vector<std::shared_ptr<std::string>> strings;
+		std::unordered_multimap<std::uint64_t, size_t> hashToIndex;
+		mutable std::mutex mutex;
+	};
+	static constexpr size_t c_shardBits = 6;
+	static constexpr size_t c_shardCount = size_t(1) << c_shardBits;
+
 	YulStringRepository() = default;
 	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
+
+	/// Parts of the FNV hash hardly differ between similar strings, so all its bits are mixed
+	/// into the top bits by a multiplication (Fibonacci hashing), which select the shard.
+	static size_t shardOf(std::uint64_t _hash)
+	{
+		return static_cast<size_t>((_hash * 0x9E3779B97F4A7C15u) >> (64 - c_shardBits));
+	}
+	/// @returns the ID of the string at @a _index in the shard @a _shardIndex. The ID zero is
+	/// reserved for the empty string, which is not stored in the shards.
+	static size_t toID(size_t _shardIndex, size_t _index) { return 1 + _index * c_shardCount + _shardIndex; }
 
 	static std::vector<std::function<void()>>& resetCallbacks()
 	{
@@ -112,8 +159,7 @@ private:
 		return callbacks;
 	}
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	std::array<Shard, c_shardCount> m_shards;
 };
 
 /// Wrapper around handles into the YulString repository.
@@ -148,16 +194,13 @@ public:
 	bool operator!=(YulString const& _other) const { return m_handle.id != _other.m_handle.id; }
 
 	bool empty() const { return m_handle.id == 0; }
-	std::string const& str() const
-	{
-		return YulStringRepository::instance().idToString(m_handle.id);
-	}
+	std::string const& str() const { return *m_handle.string; }
 
 	uint64_t hash() const { return m_handle.hash; }
 
 private:
 	/// Handle of the string. Assumes that the empty string has ID zero.
-	YulStringRepository::Handle m_handle{ 0, YulStringRepository::emptyHash() };
+	YulStringRepository::Handle m_handle{ 0, YulStringRepository::emptyHash(), YulStringRepository::emptyString() };
 };
 
 inline YulString operator "" _yulstring(char const* _string, std::size_t _size)
@@ -31,6 +31,8 @@
 
 #include <libevmasm/RuleList.h>
 
+#include <mutex>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -47,21 +49,16 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	if (!instruction)
 		return nullptr;
 
-	static std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
-
 	std::optional<EVMVersion> version;
 	if (yul::EVMDialect const* evmDialect = dynamic_cast<yul::EVMDialect const*>(&_dialect))
 		version = evmDialect->evmVersion();
 
-	if (!evmRules[version])
-		evmRules[version] = std::make_unique<SimplificationRules>(version);
-
-	SimplificationRules& rules = *evmRules[version];
+	SimplificationRules const& rules = rulesFor(version);
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
 	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
 	{
-		rules.resetMatchGroups();
+		Pattern::matchGroups().clear();
 		if (rule.pattern.matches(_expr, _dialect, _ssaValues))
 			if (!rule.feasible || rule.feasible())
 				return &rule;
@@ -69,6 +66,26 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	return nullptr;
 }
 
+SimplificationRules const& SimplificationRules::rulesFor(std::optional<EVMVersion> _evmVersion)
+{
+	// The rules are created only once and are never modified afterwards. Every thread remembers
+	// the ones it has already looked up, so that only the first lookup has to lock.
+	static map<std::optional<EVMVersion>, unique_ptr<SimplificationRules const>> evmRules;
+	static mutex evmRulesMutex;
+	thread_local map<std::optional<EVMVersion>, SimplificationRules const*> knownRules;
+
+	SimplificationRules const*& rules = knownRules[_evmVersion];
+	if (!rules)
+	{
+		lock_guard<mutex> lock(evmRulesMutex);
+		unique_ptr<SimplificationRules const>& sharedRules = evmRules[_evmVersion];
+		if (!sharedRules)
+			sharedRules = make_unique<SimplificationRules const>(_evmVersion);
+		rules = sharedRules.get();
+	}
+	return *rules;
+}
+
 bool SimplificationRules::isInitialized() const
 {
 	return !m_rules[uint8_t(evmasm::Instruction::ADD)].empty();
@@ -109,13 +126,13 @@ SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _ev
 	Pattern X;
 	Pattern Y;
 	Pattern Z;
-	A.setMatchGroup(1, m_matchGroups);
-	B.setMatchGroup(2, m_matchGroups);
-	C.setMatchGroup(3, m_matchGroups);
-	W.setMatchGroup(4, m_matchGroups);
-	X.setMatchGroup(5, m_matchGroups);
-	Y.setMatchGroup(6, m_matchGroups);
-	Z.setMatchGroup(7, m_matchGroups);
+	A.setMatchGroup(1);
+	B.setMatchGroup(2);
+	C.setMatchGroup(3);
+	W.setMatchGroup(4);
+	X.setMatchGroup(5);
+	Y.setMatchGroup(6);
+	Z.setMatchGroup(7);
 
 	addRules(simplificationRuleList(_evmVersion, A, B, C, W, X, Y, Z));
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
@@ -128,10 +145,10 @@ yul::Pattern::Pattern(evmasm::Instruction _instruction, initializer_list<Pattern
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, map<unsigned, Expression const*>& _matchGroups)
+map<unsigned, Expression const*>& Pattern::matchGroups()
 {
-	m_matchGroup = _group;
-	m_matchGroups = &_matchGroups;
+	thread_local map<unsigned, Expression const*> matchGroups;
+	return matchGroups;
 }
 
 bool Pattern::matches(
@@ -202,10 +219,11 @@ bool Pattern::matches(
 		// on the variables and not their values.
 		// The assumption is that CSE or local value numbering has been done prior to this step.
 
-		if (m_matchGroups->count(m_matchGroup))
+		map<unsigned, Expression const*>& groups = matchGroups();
+		if (groups.count(m_matchGroup))
 		{
 			assertThrow(m_kind == PatternKind::Any, OptimizerException, "Match group repetition for non-any.");
-			Expression const* firstMatch = (*m_matchGroups)[m_matchGroup];
+			Expression const* firstMatch = groups[m_matchGroup];
 			assertThrow(firstMatch, OptimizerException, "Match set but to null.");
 			assertThrow(
 				!holds_alternative<FunctionCall>(_expr) &&
@@ -217,12 +235,12 @@ bool Pattern::matches(
 			return SyntacticallyEqual{}(*firstMatch, _expr);
 		}
 		else if (m_kind == PatternKind::Any)
-			(*m_matchGroups)[m_matchGroup] = &_expr;
+			groups[m_matchGroup] = &_expr;
 		else
 		{
 			assertThrow(m_kind == PatternKind::Constant, OptimizerException, "Match group set for operation.");
 			// We do not use _expr here, because we want the actual number.
-			(*m_matchGroups)[m_matchGroup] = expr;
+			groups[m_matchGroup] = expr;
 		}
 	}
 	return true;
@@ -269,7 +287,7 @@ u256 Pattern::d() const
 Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
-	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	map<unsigned, Expression const*>& groups = matchGroups();
+	assertThrow(groups[m_matchGroup], OptimizerException, "");
+	return *groups[m_matchGroup];
 }
@@ -43,6 +43,8 @@ class Pattern;
 
 /**
  * Container for all simplification rules.
+ * The rules are immutable and shared between threads. The expressions matched by the
+ * match groups are stored per thread, see Pattern::matchGroups().
  */
 class SimplificationRules
 {
@@ -56,7 +58,7 @@ public:
 	explicit SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion = std::nullopt);
 
 	/// @returns a pointer to the first matching pattern and sets the match
-	/// groups accordingly.
+	/// groups of the calling thread accordingly.
 	/// @param _ssaValues values of variables that are assigned exactly once.
 	static Rule const* findFirstMatch(
 		Expression const& _expr,
@@ -75,9 +77,9 @@ private:
 	void addRules(std::vector<Rule> const& _rules);
 	void addRule(Rule const& _rule);
 
-	void resetMatchGroups() { m_matchGroups.clear(); }
+	/// @returns the rules for the given EVM version, which are created on first use.
+	static SimplificationRules const& rulesFor(std::optional<langutil::EVMVersion> _evmVersion);
 
-	std::map<unsigned, Expression const*> m_matchGroups;
 	std::vector<evmasm::SimplificationRule<Pattern>> m_rules[256];
 };
 
@@ -113,7 +115,7 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group) { m_matchGroup = _group; }
 	unsigned matchGroup() const { return m_matchGroup; }
 	bool matches(
 		Expression const& _expr,
@@ -132,6 +134,10 @@ public:
 	/// for patterns resulting from an action, i.e. with match groups assigned.
 	Expression toExpression(langutil::SourceLocation const& _location) const;
 
+	/// @returns the expressions matched by the match groups of the calling thread.
+	/// Only valid until the next attempt to match a rule in this thread.
+	static std::map<unsigned, Expression const*>& matchGroups();
+
 private:
 	Expression const& matchGroupValue() const;
 
@@ -140,7 +146,6 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_kind is Constant
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
 };
 
 }
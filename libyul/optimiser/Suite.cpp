@@ -72,6 +72,7 @@
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Profiler.h>
 
 #include <boost/range/algorithm_ext/erase.hpp>
 #include <libyul/CompilabilityChecker.h>
@@ -92,6 +93,7 @@ void OptimiserSuite::run(
 	set<YulString> const& _externallyUsedIdentifiers
 )
 {
+	util::ScopedTimer timer{"Yul optimiser"};
 	set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
 	reservedIdentifiers += _dialect.fixedFunctionNames();
 
@@ -118,24 +120,33 @@ void OptimiserSuite::run(
 
 	// We ignore the return value because we will get a much better error
 	// message once we perform code generation.
-	StackCompressor::run(
-		_dialect,
-		_object,
-		_optimizeStackAllocation,
-		stackCompressorMaxIterations
-	);
+	{
+		util::ScopedTimer stackCompressorTimer{"StackCompressor"};
+		StackCompressor::run(
+			_dialect,
+			_object,
+			_optimizeStackAllocation,
+			stackCompressorMaxIterations
+		);
+	}
 	suite.runSequence("fDnTOc g", ast);
 
 	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&_dialect))
 	{
 		yulAssert(_meter, "");
-		ConstantOptimiser{*dialect, *_meter}(ast);
+		{
+			util::ScopedTimer constantOptimiserTimer{"ConstantOptimiser"};
+			ConstantOptimiser{*dialect, *_meter}(ast);
+		}
 		if (dialect->providesObjectAccess() && _optimizeStackAllocation)
+		{
+			util::ScopedTimer stackLimitEvaderTimer{"StackLimitEvader"};
 			StackLimitEvader::run(suite.m_context, _object, CompilabilityChecker{
 				_dialect,
 				_object,
 				_optimizeStackAllocation
 			}.unreachableVariables);
+		}
 	}
 	else if (dynamic_cast<WasmDialect const*>(&_dialect))
 	{
@@ -174,41 +185,39 @@ map<string, unique_ptr<OptimiserStep>> optimiserStepCollection()
 
 map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 {
-	static map<string, unique_ptr<OptimiserStep>> instance;
-	if (instance.empty())
-		instance = optimiserStepCollection<
-			BlockFlattener,
-			CircularReferencesPruner,
-			CommonSubexpressionEliminator,
-			ConditionalSimplifier,
-			ConditionalUnsimplifier,
-			ControlFlowSimplifier,
-			DeadCodeEliminator,
-			EquivalentFunctionCombiner,
-			ExpressionInliner,
-			ExpressionJoiner,
-			ExpressionSimplifier,
-			ExpressionSplitter,
-			ForLoopConditionIntoBody,
-			ForLoopConditionOutOfBody,
-			ForLoopInitRewriter,
-			FullInliner,
-			FunctionGrouper,
-			FunctionHoister,
-			FunctionSpecializer,
-			LiteralRematerialiser,
-			LoadResolver,
-			LoopInvariantCodeMotion,
-			RedundantAssignEliminator,
-			ReasoningBasedSimplifier,
-			Rematerialiser,
-			SSAReverser,
-			SSATransform,
-			StructuralSimplifier,
-			UnusedFunctionParameterPruner,
-			UnusedPruner,
-			VarDeclInitializer
-		>();
+	static map<string, unique_ptr<OptimiserStep>> const instance = optimiserStepCollection<
+		BlockFlattener,
+		CircularReferencesPruner,
+		CommonSubexpressionEliminator,
+		ConditionalSimplifier,
+		ConditionalUnsimplifier,
+		ControlFlowSimplifier,
+		DeadCodeEliminator,
+		EquivalentFunctionCombiner,
+		ExpressionInliner,
+		ExpressionJoiner,
+		ExpressionSimplifier,
+		ExpressionSplitter,
+		ForLoopConditionIntoBody,
+		ForLoopConditionOutOfBody,
+		ForLoopInitRewriter,
+		FullInliner,
+		FunctionGrouper,
+		FunctionHoister,
+		FunctionSpecializer,
+		LiteralRematerialiser,
+		LoadResolver,
+		LoopInvariantCodeMotion,
+		RedundantAssignEliminator,
+		ReasoningBasedSimplifier,
+		Rematerialiser,
+		SSAReverser,
+		SSATransform,
+		StructuralSimplifier,
+		UnusedFunctionParameterPruner,
+		UnusedPruner,
+		VarDeclInitializer
+	>();
 	// Does not include VarNameCleaner because it destroys the property of unique names.
 	// Does not include NameSimplifier.
 	return instance;
@@ -350,7 +359,10 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 	{
 		if (m_debug == Debug::PrintStep)
 			cout << "Running " << step << endl;
-		allSteps().at(step)->run(m_context, _ast);
+		{
+			util::ScopedTimer timer{step};
+			allSteps().at(step)->run(m_context, _ast);
+		}
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+#------------------------------------------------------------------------------
+# Measures the execution time of the Yul interpreter on the Yul interpreter
+# tests and on any additional Yul files given as arguments.
+#
+# Usage: scripts/yul_interpreter_benchmark.sh [<file>...]
+#
+# Environment variables:
+#   SOLIDITY_BUILD_DIR: directory containing test/tools/yulrun (default: build)
+#   REPETITIONS: number of times each program is run (default: 1000)
+#------------------------------------------------------------------------------
+set -eu
+
+REPO_ROOT="$(dirname "$0")"/..
+SOLIDITY_BUILD_DIR=${SOLIDITY_BUILD_DIR:-${REPO_ROOT}/build}
+REPETITIONS=${REPETITIONS:-1000}
+YULRUN="${SOLIDITY_BUILD_DIR}/test/tools/yulrun"
+
+for file in "${REPO_ROOT}"/test/libyul/yulInterpreterTests/*.yul "$@"
+do
+	# yulrun does not support Yul objects.
+	if grep -q "^object" "$file"
+	then
+		continue
+	fi
+
+	# The step limit is the one used by the interpreter tests, which keeps the
+	# tests with infinite loops and recursion finite.
+	time=$("$YULRUN" --max-steps 512 --repeat "$REPETITIONS" "$file" 2>&1 >/dev/null | sed -n 's/^Average execution time: //p')
+	printf "%-60s %s\n" "$(basename "$file")" "$time"
+done
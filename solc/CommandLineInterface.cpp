@@ -55,6 +55,7 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/Profiler.h>
 
 #include <algorithm>
 #include <memory>
@@ -79,6 +80,7 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 
 #if !defined(STDERR_FILENO)
 	#define STDERR_FILENO 2
@@ -192,6 +194,8 @@ static string const g_strSrcMapRuntime = "srcmap-runtime";
 static string const g_strStandardJSON = "standard-json";
 static string const g_strStrictAssembly = "strict-assembly";
 static string const g_strSwarm = "swarm";
+static string const g_strTimeReport = "time-report";
+static string const g_strTraceFile = "trace-file";
 static string const g_strPrettyJson = "pretty-json";
 static string const g_strVersion = "version";
 static string const g_strIgnoreMissingFiles = "ignore-missing";
@@ -241,6 +245,8 @@ static string const g_argSignatureHashes = g_strSignatureHashes;
 static string const g_argStandardJSON = g_strStandardJSON;
 static string const g_argStorageLayout = g_strStorageLayout;
 static string const g_argStrictAssembly = g_strStrictAssembly;
+static string const g_argTimeReport = g_strTimeReport;
+static string const g_argTraceFile = g_strTraceFile;
 static string const g_argVersion = g_strVersion;
 static string const g_stdinFileName = g_stdinFileNameStr;
 static string const g_argIgnoreMissingFiles = g_strIgnoreMissingFiles;
@@ -1007,6 +1013,17 @@ General Information)").c_str(),
 			po::value<string>()->value_name(boost::join(g_combinedJsonArgs, ",")),
 			"Output a single json document containing the specified information."
 		)
+		(
+			g_argTimeReport.c_str(),
+			"Print the time spent in each phase of the compilation and the increase of the peak memory "
+			"usage during the phase to stderr."
+		)
+		(
+			g_argTraceFile.c_str(),
+			po::value<string>()->value_name("path"),
+			"Write every run of each phase of the compilation to the given file in the trace event "
+			"format of the Chrome trace viewer."
+		)
 	;
 	desc.add(extraOutput);
 
@@ -1178,6 +1195,9 @@ General Information)").c_str(),
 
 bool CommandLineInterface::processInput()
 {
+	if (m_args.count(g_argTimeReport) || m_args.count(g_argTraceFile))
+		util::Profiler::start(m_args.count(g_argTraceFile) > 0);
+
 	if (m_args.count(g_argBasePath))
 	{
 		boost::filesystem::path const fspath{m_args[g_argBasePath].as<string>()};
@@ -1260,7 +1280,8 @@ bool CommandLineInterface::processInput()
 			}
 		}
 		StandardCompiler compiler(m_fileReader.reader());
-		sout() << compiler.compile(std::move(input)) << endl;
+		compiler.compile(input, sout());
+		sout() << endl;
 		return true;
 	}
 
@@ -1543,7 +1564,8 @@ bool CommandLineInterface::processInput()
 		}
 		else
 		{
-			m_compiler->setSources(m_fileReader.sourceCodes());
+			// The sources are not needed by the file reader after this point, the compiler keeps them.
+			m_compiler->setSources(m_fileReader.takeSources());
 			if (m_args.count(g_argErrorRecovery))
 				m_compiler->setParserErrorRecovery(true);
 		}
@@ -1632,18 +1654,22 @@ void CommandLineInterface::handleCombinedJSON()
 	if (!m_args.count(g_argCombinedJson))
 		return;
 
-	Json::Value output(Json::objectValue);
+	// The output is serialized piece by piece instead of being built as a whole, which requires
+	// the members of each object to be written in the order of their names. It is only passed on
+	// once it is complete, so that an error does not leave partial output behind.
+	ostringstream outputBuffer;
+	util::JsonStreamWriter output(outputBuffer, m_args.count(g_argPrettyJson));
+	output.beginObject();
 
-	output[g_strVersion] = frontend::VersionString;
 	set<string> requests;
 	boost::split(requests, m_args[g_argCombinedJson].as<string>(), boost::is_any_of(","));
 	vector<string> contracts = m_compiler->contractNames();
 
 	if (!contracts.empty())
-		output[g_strContracts] = Json::Value(Json::objectValue);
+		output.beginObject(g_strContracts);
 	for (string const& contractName: contracts)
 	{
-		Json::Value& contractData = output[g_strContracts][contractName] = Json::objectValue;
+		Json::Value contractData(Json::objectValue);
 		if (requests.count(g_strAbi))
 			contractData[g_strAbi] = m_compiler->contractABI(contractName);
 		if (requests.count("metadata"))
@@ -1678,36 +1704,41 @@ void CommandLineInterface::handleCombinedJSON()
 			contractData[g_strNatspecDev] = m_compiler->natspecDev(contractName);
 		if (requests.count(g_strNatspecUser))
 			contractData[g_strNatspecUser] = m_compiler->natspecUser(contractName);
+		output.writeMember(contractName, removeNullMembers(std::move(contractData)));
 	}
+	if (!contracts.empty())
+		output.endObject();
 
 	bool needsSourceList = requests.count(g_strAst) || requests.count(g_strSrcMap) || requests.count(g_strSrcMapRuntime);
 	if (needsSourceList)
 	{
 		// Indices into this array are used to abbreviate source names in source locations.
-		output[g_strSourceList] = Json::Value(Json::arrayValue);
-
+		Json::Value sourceList(Json::arrayValue);
 		for (auto const& source: m_compiler->sourceNames())
-			output[g_strSourceList].append(source);
+			sourceList.append(source);
+		output.writeMember(g_strSourceList, sourceList);
 	}
 
 	if (requests.count(g_strAst))
 	{
-		output[g_strSources] = Json::Value(Json::objectValue);
-		for (auto const& sourceCode: m_fileReader.sourceCodes())
+		output.beginObject(g_strSources);
+		for (string const& sourceName: m_compiler->sourceNames())
 		{
 			ASTJsonConverter converter(m_compiler->state(), m_compiler->sourceIndices());
-			output[g_strSources][sourceCode.first] = Json::Value(Json::objectValue);
-			output[g_strSources][sourceCode.first]["AST"] = converter.toJson(m_compiler->ast(sourceCode.first));
+			Json::Value sourceData(Json::objectValue);
+			sourceData["AST"] = converter.toJson(m_compiler->ast(sourceName));
+			output.writeMember(sourceName, removeNullMembers(std::move(sourceData)));
 		}
+		output.endObject();
 	}
 
-	string json = m_args.count(g_argPrettyJson) ? jsonPrettyPrint(removeNullMembers(std::move(output))) :
-		jsonCompactPrint(removeNullMembers(std::move(output)));
+	output.writeMember(g_strVersion, frontend::VersionString);
+	output.endObject();
 
 	if (m_args.count(g_argOutputDir))
-		createJson("combined", json);
+		createJson("combined", outputBuffer.str());
 	else
-		sout() << json << endl;
+		sout() << outputBuffer.rdbuf() << endl;
 }
 
 void CommandLineInterface::handleAst()
@@ -1716,42 +1747,66 @@ void CommandLineInterface::handleAst()
 		return;
 
 	vector<ASTNode const*> asts;
-	for (auto const& sourceCode: m_fileReader.sourceCodes())
-		asts.push_back(&m_compiler->ast(sourceCode.first));
+	for (string const& sourceName: m_compiler->sourceNames())
+		asts.push_back(&m_compiler->ast(sourceName));
 
 	if (m_args.count(g_argOutputDir))
 	{
-		for (auto const& sourceCode: m_fileReader.sourceCodes())
+		for (string const& sourceName: m_compiler->sourceNames())
 		{
 			stringstream data;
 			string postfix = "";
-			ASTJsonConverter(m_compiler->state(), m_compiler->sourceIndices()).print(data, m_compiler->ast(sourceCode.first));
+			ASTJsonConverter(m_compiler->state(), m_compiler->sourceIndices()).print(data, m_compiler->ast(sourceName));
 			postfix += "_json";
-			boost::filesystem::path path(sourceCode.first);
+			boost::filesystem::path path(sourceName);
 			createFile(path.filename().string() + postfix + ".ast", data.str());
 		}
 	}
 	else
 	{
 		sout() << "JSON AST (compact format):" << endl << endl;
-		for (auto const& sourceCode: m_fileReader.sourceCodes())
+		for (string const& sourceName: m_compiler->sourceNames())
 		{
-			sout() << endl << "======= " << sourceCode.first << " =======" << endl;
-			ASTJsonConverter(m_compiler->state(), m_compiler->sourceIndices()).print(sout(), m_compiler->ast(sourceCode.first));
+			sout() << endl << "======= " << sourceName << " =======" << endl;
+			ASTJsonConverter(m_compiler->state(), m_compiler->sourceIndices()).print(sout(), m_compiler->ast(sourceName));
 		}
 	}
 }
 
 bool CommandLineInterface::actOnInput()
 {
+	bool success = true;
 	if (m_args.count(g_argStandardJSON) || m_onlyAssemble)
+	{
 		// Already done in "processInput" phase.
-		return true;
-	else if (m_onlyLink)
-		writeLinkedFiles();
+	}
 	else
-		outputCompilationResults();
-	return !m_error;
+	{
+		if (m_onlyLink)
+			writeLinkedFiles();
+		else
+			outputCompilationResults();
+		success = !m_error;
+	}
+
+	if (m_args.count(g_argTimeReport) || m_args.count(g_argTraceFile))
+	{
+		util::Profiler::Phase phases = util::Profiler::stop();
+		if (m_args.count(g_argTimeReport))
+			serr() << endl << util::Profiler::formatTable(phases);
+		if (m_args.count(g_argTraceFile))
+		{
+			string traceFile = m_args.at(g_argTraceFile).as<string>();
+			ofstream outFile(traceFile);
+			outFile << jsonCompactPrint(util::Profiler::toTraceJson(util::Profiler::traceEvents()));
+			if (!outFile)
+			{
+				serr() << "Could not write to file \"" << traceFile << "\"." << endl;
+				success = false;
+			}
+		}
+	}
+	return success;
 }
 
 bool CommandLineInterface::link()
@@ -1999,6 +2054,7 @@ bool CommandLineInterface::assemble(
 
 void CommandLineInterface::outputCompilationResults()
 {
+	util::ScopedTimer timer{"output"};
 	handleCombinedJSON();
 
 	// do we need AST output?
@@ -2013,6 +2069,12 @@ void CommandLineInterface::outputCompilationResults()
 		return;
 	}
 
+	// Imported sources are not retained by the file reader, so take them from the compiler.
+	StringMap sourceCodes;
+	if (m_args.count(g_argAsm) && !m_args.count(g_argAsmJson))
+		for (string const& sourceName: m_compiler->sourceNames())
+			sourceCodes[sourceName] = m_compiler->scanner(sourceName).source();
+
 	vector<string> contracts = m_compiler->contractNames();
 	for (string const& contract: contracts)
 	{
@@ -2026,7 +2088,7 @@ void CommandLineInterface::outputCompilationResults()
 			if (m_args.count(g_argAsmJson))
 				ret = jsonPrettyPrint(removeNullMembers(m_compiler->assemblyJSON(contract)));
 			else
-				ret = m_compiler->assemblyString(contract, m_fileReader.sourceCodes());
+				ret = m_compiler->assemblyString(contract, sourceCodes);
 
 			if (m_args.count(g_argOutputDir))
 			{
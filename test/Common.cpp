@@ -19,11 +19,14 @@
 #include <stdexcept>
 #include <iostream>
 #include <test/Common.h>
+#include <test/libsolidity/util/CompilationCache.h>
 
 #include <libsolutil/Assertions.h>
 #include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
 
+#include <regex>
+
 namespace fs = boost::filesystem;
 namespace po = boost::program_options;
 
@@ -107,7 +110,14 @@ CommonOptions::CommonOptions(std::string _caption):
 		("enforce-gas-cost-min-value", po::value(&enforceGasTestMinValue), "Threshold value to enforce adding gas checks to a test.")
 		("abiencoderv1", po::bool_switch(&useABIEncoderV1), "enables abi encoder v1")
 		("show-messages", po::bool_switch(&showMessages), "enables message output")
-		("show-metadata", po::bool_switch(&showMetadata), "enables metadata output");
+		("show-metadata", po::bool_switch(&showMetadata), "enables metadata output")
+		("shard", po::value(&shardString), "only run the tests of the given shard, specified as <index>/<count> with index < count.")
+		(
+			"compilation-cache",
+			po::value<fs::path>(&compilationCache),
+			"directory in which contracts compiled by semantic tests are cached across runs. "
+			"It must only be writable by the current user. Disabled by default."
+		);
 }
 
 void CommonOptions::validate() const
@@ -135,6 +145,19 @@ void CommonOptions::validate() const
 			"Gas costs can only be enforced on abi encoder v2."
 		);
 	}
+	validateCompilationCache();
+}
+
+void CommonOptions::validateCompilationCache() const
+{
+	// Entries of the cache are trusted, so nobody else may be able to plant them.
+	if (!compilationCache.empty())
+		assertThrow(
+			frontend::test::CompilationCache::prepareDirectory(compilationCache),
+			ConfigException,
+			"The compilation cache directory " + compilationCache.string() +
+			" could not be created or is writable by other users."
+		);
 }
 
 bool CommonOptions::parse(int argc, char const* const* argv)
@@ -162,6 +185,17 @@ bool CommonOptions::parse(int argc, char const* const* argv)
 			BOOST_THROW_EXCEPTION(std::runtime_error(errorMessage.str()));
 		}
 
+	if (!shardString.empty())
+	{
+		std::smatch match;
+		if (!std::regex_match(shardString, match, std::regex("([0-9]{1,9})/([0-9]{1,9})")))
+			BOOST_THROW_EXCEPTION(std::runtime_error("Invalid shard: " + shardString + ". Expected <index>/<count>."));
+		shardIndex = std::stoul(match[1]);
+		shardCount = std::stoul(match[2]);
+		if (shardIndex >= shardCount)
+			BOOST_THROW_EXCEPTION(std::runtime_error("Invalid shard: " + shardString + ". The index must be less than the count."));
+	}
+
 	if (vmPaths.empty())
 	{
 		std::string evmone = envOrDefaultPath("ETH_EVMONE", evmoneFilename);
@@ -206,6 +240,20 @@ langutil::EVMVersion CommonOptions::evmVersion() const
 		return langutil::EVMVersion();
 }
 
+bool CommonOptions::isInShard(std::string const& _testName) const
+{
+	if (shardCount <= 1)
+		return true;
+
+	// FNV-1a, so that the assignment is the same on every platform and in every build.
+	uint64_t hash = 14695981039346656037u;
+	for (char c: _testName)
+	{
+		hash ^= static_cast<uint8_t>(c);
+		hash *= 1099511628211u;
+	}
+	return hash % shardCount == shardIndex;
+}
 
 CommonOptions const& CommonOptions::get()
 {
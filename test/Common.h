@@ -65,8 +65,18 @@ struct CommonOptions
 	bool useABIEncoderV1 = false;
 	bool showMessages = false;
 	bool showMetadata = false;
+	/// Index of the shard to run and the total number of shards. Every test belongs to exactly
+	/// one shard, determined by a hash of its name, so the assignment does not depend on the
+	/// order in which tests are discovered.
+	size_t shardIndex = 0;
+	size_t shardCount = 1;
+	/// Directory of the on-disk cache of contracts compiled by semantic tests, empty if the
+	/// cache is disabled, which is the default.
+	boost::filesystem::path compilationCache;
 
 	langutil::EVMVersion evmVersion() const;
+	/// @returns true if the test with the given name belongs to the selected shard.
+	bool isInShard(std::string const& _testName) const;
 
 	virtual bool parse(int argc, char const* const* argv);
 	// Throws a ConfigException on error
@@ -79,10 +89,15 @@ struct CommonOptions
 	virtual ~CommonOptions() {}
 
 protected:
+	/// Creates the directory of the compilation cache if necessary and throws a ConfigException
+	/// if other users could write to it.
+	void validateCompilationCache() const;
+
 	boost::program_options::options_description options;
 
 private:
 	std::string evmVersionString;
+	std::string shardString;
 	static std::unique_ptr<CommonOptions const> m_singleton;
 };
 
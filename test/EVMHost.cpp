@@ -144,6 +144,10 @@ void EVMHost::reset()
 {
 	accounts.clear();
 	m_currentAddress = {};
+	// Start again with the first block.
+	tx_context.block_number = 0;
+	tx_context.block_timestamp = 0;
+	recorded_logs.clear();
 	// Clear self destruct records
 	recorded_selfdestructs.clear();
 	// Clear call records
@@ -166,6 +170,32 @@ void EVMHost::reset()
 	}
 }
 
+EVMHost::Snapshot EVMHost::snapshot() const
+{
+	assertThrow(m_currentAddress == evmc::address{}, Exception, "Snapshots cannot be taken during a call.");
+	Snapshot snapshot;
+	snapshot.m_state = make_shared<Snapshot::State const>(Snapshot::State{
+		m_evmVersion,
+		accounts,
+		tx_context,
+		recorded_logs,
+		recorded_selfdestructs
+	});
+	return snapshot;
+}
+
+void EVMHost::revert(Snapshot const& _snapshot)
+{
+	assertThrow(_snapshot.m_state, Exception, "Empty snapshot.");
+	assertThrow(_snapshot.m_state->evmVersion == m_evmVersion, Exception, "Snapshot was taken for a different EVM version.");
+	accounts = _snapshot.m_state->accounts;
+	tx_context = _snapshot.m_state->txContext;
+	recorded_logs = _snapshot.m_state->logs;
+	recorded_selfdestructs = _snapshot.m_state->selfdestructs;
+	recorded_calls.clear();
+	m_currentAddress = {};
+}
+
 void EVMHost::selfdestruct(const evmc::address& _addr, const evmc::address& _beneficiary) noexcept
 {
 	// TODO actual selfdestruct is even more complicated.
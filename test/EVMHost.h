@@ -32,6 +32,8 @@
 
 #include <boost/filesystem.hpp>
 
+#include <memory>
+
 namespace solidity::test
 {
 using Address = util::h160;
@@ -52,9 +54,34 @@ public:
 	/// @returns true, if an evmc vm was supporting evm1 loaded properly.
 	static bool checkVmPaths(std::vector<boost::filesystem::path> const& _vmPaths);
 
+	/**
+	 * Immutable copy of the accounts, the transaction context and the recorded logs and
+	 * self-destructs of a host. Copies of a snapshot share its data, so that a snapshot can be
+	 * kept around and restored any number of times, also into other hosts for the same EVM
+	 * version.
+	 */
+	class Snapshot
+	{
+	private:
+		friend class EVMHost;
+		struct State
+		{
+			langutil::EVMVersion evmVersion;
+			std::unordered_map<evmc::address, evmc::MockedAccount> accounts;
+			evmc_tx_context txContext;
+			std::vector<log_record> logs;
+			std::vector<selfdestuct_record> selfdestructs;
+		};
+		std::shared_ptr<State const> m_state;
+	};
+
 	explicit EVMHost(langutil::EVMVersion _evmVersion, evmc::VM& _vm);
 
 	void reset();
+	/// @returns a snapshot of the current state. Must not be called during a call.
+	Snapshot snapshot() const;
+	/// Restores the state recorded in @a _snapshot and clears the recorded calls.
+	void revert(Snapshot const& _snapshot);
 	void newBlock()
 	{
 		tx_context.block_number++;
@@ -87,6 +87,20 @@ void ExecutionFramework::reset()
 			EVMHost::convertToEVMC(u256(1) << 100);
 }
 
+ExecutionFramework::Snapshot ExecutionFramework::snapshot() const
+{
+	return {m_evmcHost->snapshot(), m_contractAddress, m_transactionSuccessful, m_output, m_gasUsed};
+}
+
+void ExecutionFramework::revertTo(Snapshot const& _snapshot)
+{
+	m_evmcHost->revert(_snapshot.host);
+	m_contractAddress = _snapshot.contractAddress;
+	m_transactionSuccessful = _snapshot.transactionSuccessful;
+	m_output = _snapshot.output;
+	m_gasUsed = _snapshot.gasUsed;
+}
+
 std::pair<bool, string> ExecutionFramework::compareAndCreateMessage(
 	bytes const& _result,
 	bytes const& _expectation
@@ -195,6 +209,26 @@ void ExecutionFramework::sendMessage(bytes const& _data, bool _isCreation, u256
 	}
 }
 
+void ExecutionFramework::sendCreationMessage(
+	map<bytes, Snapshot>& _deployments,
+	bytes const& _data,
+	u256 const& _value
+)
+{
+	// Every transaction starts a new block, so this is only zero before the first one. Any earlier
+	// transaction could have changed the state the deployment depends on.
+	solAssert(blockNumber() == 0, "Deployments can only be reused if they are the first transaction after a reset.");
+
+	bytes key = m_sender.asBytes() + toBigEndian(_value) + _data;
+	if (Snapshot const* deployment = util::valueOrNullptr(_deployments, key))
+		revertTo(*deployment);
+	else
+	{
+		sendMessage(_data, true, _value);
+		_deployments.emplace(std::move(key), snapshot());
+	}
+}
+
 void ExecutionFramework::sendEther(h160 const& _addr, u256 const& _amount)
 {
 	m_evmcHost->newBlock();
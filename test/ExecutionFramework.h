@@ -36,6 +36,7 @@
 #include <libsolutil/ErrorCodes.h>
 
 #include <functional>
+#include <map>
 
 #include <boost/test/unit_test.hpp>
 
@@ -51,6 +52,17 @@ class ExecutionFramework
 {
 
 public:
+	/// State of the chain together with the address of the last created contract and the
+	/// result of the last transaction.
+	struct Snapshot
+	{
+		EVMHost::Snapshot host;
+		util::h160 contractAddress;
+		bool transactionSuccessful = true;
+		bytes output;
+		u256 gasUsed;
+	};
+
 	ExecutionFramework();
 	ExecutionFramework(langutil::EVMVersion _evmVersion, std::vector<boost::filesystem::path> const& _vmPaths);
 	virtual ~ExecutionFramework() = default;
@@ -258,8 +270,17 @@ private:
 protected:
 	void selectVM(evmc_capabilities _cap = evmc_capabilities::EVMC_CAPABILITY_EVM1);
 	void reset();
+	Snapshot snapshot() const;
+	/// Restores @a _snapshot, which may have been taken by another instance of the framework
+	/// for the same EVM version.
+	void revertTo(Snapshot const& _snapshot);
 
 	void sendMessage(bytes const& _data, bool _isCreation, u256 const& _value = 0);
+	/// Sends a transaction creating a contract from @a _data, which has to be the first
+	/// transaction after a reset. The resulting state is stored in @a _deployments and
+	/// restored from there when the same transaction is sent again, also by other instances
+	/// of the framework, so that the constructor is only executed once.
+	void sendCreationMessage(std::map<bytes, Snapshot>& _deployments, bytes const& _data, u256 const& _value = 0);
 	void sendEther(util::h160 const& _to, u256 const& _value);
 	size_t currentTimestamp();
 	size_t blockTimestamp(u256 _number);
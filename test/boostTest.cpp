@@ -30,6 +30,8 @@
 #pragma warning(disable:4535) // calling _set_se_translator requires /EHa
 #endif
 #include <boost/test/unit_test.hpp>
+#include <boost/test/tree/visitor.hpp>
+#include <boost/test/tree/traverse.hpp>
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
@@ -143,6 +145,30 @@ int registerTests(
 	return numTestsAdded;
 }
 
+/// Collects the test cases that do not belong to the shard selected with --shard.
+class ShardFilter: public test_tree_visitor
+{
+public:
+	void visit(test_case const& _testCase) override
+	{
+		if (!solidity::test::CommonOptions::get().isInShard(_testCase.full_name()))
+			m_excluded.push_back(&_testCase);
+	}
+
+	std::vector<test_case const*> const& excluded() const { return m_excluded; }
+
+private:
+	std::vector<test_case const*> m_excluded;
+};
+
+void removeTestsOutsideShard()
+{
+	ShardFilter filter;
+	traverse_test_tree(framework::master_test_suite(), filter);
+	for (test_case const* testCase: filter.excluded())
+		framework::get<test_suite>(testCase->p_parent_id).remove(testCase->p_id);
+}
+
 void initializeOptions()
 {
 	auto const& suite = boost::unit_test::framework::master_test_suite();
@@ -208,6 +234,7 @@ test_suite* init_unit_test_suite( int /*argc*/, char* /*argv*/[] )
 			"SolidityAuctionRegistrar",
 			"SolidityFixedFeeRegistrar",
 			"SolidityWallet",
+			"EVMHostSnapshot",
 			"GasMeterTests",
 			"GasCostTests",
 			"SolidityEndToEndTest",
@@ -216,6 +243,9 @@ test_suite* init_unit_test_suite( int /*argc*/, char* /*argv*/[] )
 			removeTestSuite(suite);
 	}
 
+	if (solidity::test::CommonOptions::get().shardCount > 1)
+		removeTestsOutsideShard();
+
 	return nullptr;
 }
 
@@ -146,6 +146,7 @@ function test_solc_behaviour()
         sed -i.bak -e 's/"errors":\[\],\{0,1\}//' "$stdout_path"
         sed -i.bak -E -e 's/\"opcodes\":\"[^"]+\"/\"opcodes\":\"<OPCODES REMOVED>\"/g' "$stdout_path"
         sed -i.bak -E -e 's/\"sourceMap\":\"[0-9:;-]+\"/\"sourceMap\":\"<SOURCEMAP REMOVED>\"/g' "$stdout_path"
+        sed -i.bak -E -e 's/\"(durationMicroseconds|peakMemoryIncrease)\":[0-9]+/\"\1\":\"<PROFILE REMOVED>\"/g' "$stdout_path"
 
         # Remove bytecode (but not linker references).
         sed -i.bak -E -e 's/(\"object\":\")[0-9a-f]+([^"]*\")/\1<BYTECODE REMOVED>\2/g' "$stdout_path"
@@ -164,6 +165,9 @@ function test_solc_behaviour()
         sed -i.bak -e 's/\(^[ ]*auxdata: \)0x[0-9a-f]*$/\1<AUXDATA REMOVED>/' "$stdout_path"
         sed -i.bak -e 's/ Consider adding "pragma .*$//' "$stderr_path"
         sed -i.bak -e 's/\(Unimplemented feature error.* in \).*$/\1<FILENAME REMOVED>/' "$stderr_path"
+        # Remove the timings and memory usage from the table of --time-report, which is aligned by them.
+        sed -i.bak -E -e 's/^Phase +Time \(ms\) +Share +Calls +Memory \(KiB\)$/Phase Time (ms) Share Calls Memory (KiB)/' "$stderr_path"
+        sed -i.bak -E -e 's/^( *)([^ ]|[^ ].*[^ ]) +[0-9]+\.[0-9]{3} +[0-9]+\.[0-9]% +([0-9]+) +[0-9]+$/\1\2 <TIME REMOVED> \3 <MEMORY REMOVED>/' "$stderr_path"
         sed -i.bak -e 's/"version":[ ]*"[^"]*"/"version": "<VERSION REMOVED>"/' "$stdout_path"
 
         # Remove bytecode (but not linker references). Since non-JSON output is unstructured,
@@ -485,6 +489,23 @@ SOLTMPDIR=$(mktemp -d)
     fi
 )
 
+printTask "Testing trace file..."
+SOLTMPDIR=$(mktemp -d)
+(
+    set -e
+    cd "$SOLTMPDIR"
+    echo 'contract C { function f() public pure {} }' > x.sol
+    "$SOLC" --bin --trace-file trace.json x.sol &>/dev/null
+    # Every run of a phase is a complete event ("ph":"X"); members are sorted by name.
+    grep -q '"displayTimeUnit":"ms"' trace.json
+    grep -q '"name":"parsing","ph":"X"' trace.json
+    grep -q '"name":"x.sol:C","ph":"X"' trace.json
+    # Failing to write the trace fails the compilation.
+    "$SOLC" --bin --trace-file missing/trace.json x.sol &>/dev/null && exit 1
+    true
+)
+rm -rf "$SOLTMPDIR"
+
 printTask "Testing AST import..."
 SOLTMPDIR=$(mktemp -d)
 (
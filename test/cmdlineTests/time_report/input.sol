@@ -0,0 +1,3 @@
+pragma solidity >=0.0;
+
+contract C {}
@@ -216,6 +216,7 @@ contract GlobalRegistrar is Registrar, AuctionSystem {
 )DELIMITER";
 
 static LazyInit<bytes> s_compiledRegistrar;
+static map<bytes, ExecutionFramework::Snapshot> s_deployedRegistrar;
 
 class AuctionRegistrarTestFramework: public SolidityExecutionFramework
 {
@@ -226,7 +227,7 @@ protected:
 			return compileContract(registrarCode, "GlobalRegistrar");
 		});
 
-		sendMessage(compiled, true);
+		sendCreationMessage(s_deployedRegistrar, compiled);
 		BOOST_REQUIRE(m_transactionSuccessful);
 		BOOST_REQUIRE(!m_output.empty());
 	}
@@ -127,6 +127,7 @@ contract FixedFeeRegistrar is Registrar {
 )DELIMITER";
 
 static LazyInit<bytes> s_compiledRegistrar;
+static map<bytes, ExecutionFramework::Snapshot> s_deployedRegistrar;
 
 class RegistrarTestFramework: public SolidityExecutionFramework
 {
@@ -137,7 +138,7 @@ protected:
 			return compileContract(registrarCode, "FixedFeeRegistrar");
 		});
 
-		sendMessage(compiled, true);
+		sendCreationMessage(s_deployedRegistrar, compiled);
 		BOOST_REQUIRE(m_transactionSuccessful);
 		BOOST_REQUIRE(!m_output.empty());
 	}
@@ -439,6 +439,7 @@ contract Wallet is multisig, multiowned, daylimit {
 )DELIMITER";
 
 static LazyInit<bytes> s_compiledWallet;
+static map<bytes, ExecutionFramework::Snapshot> s_deployedWallets;
 
 class WalletTestFramework: public SolidityExecutionFramework
 {
@@ -455,7 +456,7 @@ protected:
 		});
 
 		bytes args = encodeArgs(u256(0x60), _required, _dailyLimit, u256(_owners.size()), _owners);
-		sendMessage(compiled + args, true, _value);
+		sendCreationMessage(s_deployedWallets, compiled + args, _value);
 		BOOST_REQUIRE(m_transactionSuccessful);
 		BOOST_REQUIRE(!m_output.empty());
 	}
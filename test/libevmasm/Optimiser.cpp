@@ -29,6 +29,7 @@
 #include <libevmasm/JumpdestRemover.h>
 #include <libevmasm/ControlFlowGraph.h>
 #include <libevmasm/BlockDeduplicator.h>
+#include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/Assembly.h>
 
 #include <boost/test/unit_test.hpp>
@@ -1266,6 +1267,44 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(constant_optimiser_repeated_assemblies)
+{
+	// The constant optimiser can share its decisions between assemblies. Optimising the same
+	// constants in a second assembly has to yield the same result, including data added by code copy.
+	u256 const mask = (u256(1) << 160) - 1;
+	u256 const randomValue("0x5f2e0b3a8d6c4e1f90a7b3c2d4e5f60718293a4b5c6d7e8f9012a3b4c5d6e7f8");
+	for (bool isCreation: {false, true})
+		for (size_t runs: {1u, 200u, 100000u})
+		{
+			ConstantOptimiserCache cache;
+			auto optimised = [&]() {
+				Assembly assembly;
+				for (unsigned i = 0; i < 4; i++)
+				{
+					assembly.append(mask);
+					assembly.append(randomValue);
+					assembly.append(Instruction::POP);
+					assembly.append(Instruction::POP);
+				}
+				ConstantOptimisationMethod::optimiseConstants(
+					isCreation,
+					runs,
+					solidity::test::CommonOptions::get().evmVersion(),
+					assembly,
+					&cache
+				);
+				return assembly;
+			};
+			Assembly first = optimised();
+			Assembly second = optimised();
+			BOOST_CHECK_EQUAL_COLLECTIONS(
+				first.items().begin(), first.items().end(),
+				second.items().begin(), second.items().end()
+			);
+			BOOST_CHECK(first.assemble().bytecode == second.assemble().bytecode);
+		}
+}
+
 BOOST_AUTO_TEST_CASE(cse_sub_zero)
 {
 	checkCSE({
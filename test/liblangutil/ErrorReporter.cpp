@@ -0,0 +1,91 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for merging the errors of several error reporters.
+ */
+
+#include <liblangutil/ErrorReporter.h>
+#include <liblangutil/Exceptions.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::langutil::test
+{
+
+namespace
+{
+
+ErrorList warnings(size_t _count)
+{
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+	for (size_t i = 0; i < _count; ++i)
+		reporter.warning(1234_error, "Warning");
+	return errors;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ErrorReporterTest)
+
+BOOST_AUTO_TEST_CASE(append_does_not_count)
+{
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+	reporter.append(warnings(200));
+	for (size_t i = 0; i < 200; ++i)
+		reporter.warning(1234_error, "Warning");
+	BOOST_CHECK_EQUAL(errors.size(), 400u);
+	BOOST_CHECK(!reporter.hasErrors());
+}
+
+BOOST_AUTO_TEST_CASE(merge_counts_warnings)
+{
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+	reporter.merge(warnings(200));
+	reporter.merge(warnings(200));
+	// The 256th warning is replaced by the note that the rest is ignored.
+	BOOST_REQUIRE_EQUAL(errors.size(), 256u);
+	BOOST_CHECK(errors.back()->errorId() == 4591_error);
+	BOOST_CHECK(!reporter.hasErrors());
+}
+
+BOOST_AUTO_TEST_CASE(merge_counts_errors)
+{
+	ErrorList otherErrors;
+	ErrorReporter otherReporter(otherErrors);
+	otherReporter.typeError(1234_error, SourceLocation{}, "Error");
+
+	ErrorList errors;
+	ErrorReporter reporter(errors);
+	reporter.merge(otherErrors);
+	BOOST_CHECK_EQUAL(errors.size(), 1u);
+	BOOST_CHECK(reporter.hasErrors());
+
+	for (size_t i = 0; i < 255; ++i)
+		reporter.merge(otherErrors);
+	BOOST_CHECK_THROW(reporter.merge(otherErrors), FatalError);
+	BOOST_CHECK(reporter.hasExcessiveErrors());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
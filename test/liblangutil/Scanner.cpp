@@ -761,6 +761,48 @@ BOOST_AUTO_TEST_CASE(multiline_comment_at_eos)
 	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
 }
 
+BOOST_AUTO_TEST_CASE(multiline_comment_terminator_after_stars)
+{
+	Scanner scanner(CharStream("/* a * b **/ x /***/ y", ""));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "x");
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "y");
+	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+}
+
+BOOST_AUTO_TEST_CASE(long_comments_with_non_ascii_characters)
+{
+	string const text = string(1000, 'a') + " \xC3\xA4\xC2\xA0\xE2\x82\xAC " + string(1000, 'b');
+	Scanner scanner(CharStream("// " + text + "\n/* " + text + " */ x", ""));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "x");
+	BOOST_CHECK_EQUAL(scanner.currentLocation().start, 2 * static_cast<int>(text.size()) + 11);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+}
+
+BOOST_AUTO_TEST_CASE(directional_override_at_end_of_long_comment)
+{
+	string const text = string(1000, 'a') + "\xE2\x80\xAE";
+	Scanner scanner(CharStream("/* " + text + " */ x", ""));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+	BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::DirectionalOverrideMismatch);
+	Scanner lineScanner(CharStream("// " + text + "\xE2\x80\xAC\xE2\x80\xAC\nx", ""));
+	BOOST_CHECK_EQUAL(lineScanner.currentToken(), Token::Illegal);
+	BOOST_CHECK_EQUAL(lineScanner.currentError(), ScannerError::DirectionalOverrideUnderflow);
+}
+
+BOOST_AUTO_TEST_CASE(identifier_at_eos)
+{
+	Scanner scanner(CharStream("abc d_e$0", ""));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "abc");
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "d_e$0");
+	BOOST_CHECK_EQUAL(scanner.currentLocation().end, 9);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+}
+
 BOOST_AUTO_TEST_CASE(regular_line_break_in_single_line_comment)
 {
 	for (auto const& nl: {"\r", "\n", "\r\n"})
@@ -0,0 +1,124 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Tests for the state snapshots of EVMHost.
+ */
+
+#include <test/libsolidity/SolidityExecutionFramework.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace solidity::util;
+using namespace solidity::test;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+char const* sourceCode = R"(
+	contract C {
+		uint public x;
+		event Set(uint);
+		constructor() payable {}
+		function set(uint _x) public payable {
+			x = _x;
+			emit Set(_x);
+		}
+		function destroy(address payable _beneficiary) public {
+			selfdestruct(_beneficiary);
+		}
+	}
+)";
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(EVMHostSnapshot, SolidityExecutionFramework)
+
+BOOST_AUTO_TEST_CASE(revert_restores_state)
+{
+	compileAndRun(sourceCode, 10);
+	h160 const contract = m_contractAddress;
+	h160 const beneficiary = account(1);
+	ABI_CHECK(callContractFunctionWithValue("set(uint256)", 5, u256(7)), encodeArgs());
+	BOOST_REQUIRE_EQUAL(numLogs(), 1);
+	u256 const senderBalance = balanceAt(m_sender);
+	u256 const beneficiaryBalance = balanceAt(beneficiary);
+	u256 const blockNumberAtSnapshot = blockNumber();
+	EVMHost::Snapshot const state = m_evmcHost->snapshot();
+
+	// Change storage and balances, emit a log, create an account and remove one.
+	ABI_CHECK(callContractFunctionWithValue("set(uint256)", 3, u256(9)), encodeArgs());
+	compileAndRun(sourceCode);
+	h160 const otherContract = m_contractAddress;
+	BOOST_REQUIRE(addressHasCode(otherContract));
+	m_contractAddress = contract;
+	ABI_CHECK(callContractFunction("destroy(address)", beneficiary), encodeArgs());
+	BOOST_REQUIRE(!addressHasCode(contract));
+	BOOST_REQUIRE_EQUAL(balanceAt(beneficiary), beneficiaryBalance + 18);
+	BOOST_REQUIRE_EQUAL(m_evmcHost->recorded_selfdestructs.size(), 1);
+
+	// A snapshot can be restored any number of times.
+	for (size_t i = 0; i < 2; ++i)
+	{
+		m_evmcHost->revert(state);
+
+		BOOST_CHECK_EQUAL(blockNumber(), blockNumberAtSnapshot);
+		BOOST_CHECK(addressHasCode(contract));
+		BOOST_CHECK(!addressHasCode(otherContract));
+		BOOST_CHECK(m_evmcHost->recorded_selfdestructs.empty());
+		BOOST_CHECK(m_evmcHost->recorded_calls.empty());
+
+		BOOST_CHECK_EQUAL(balanceAt(contract), 15);
+		BOOST_CHECK_EQUAL(balanceAt(beneficiary), beneficiaryBalance);
+		BOOST_CHECK_EQUAL(balanceAt(m_sender), senderBalance);
+
+		BOOST_CHECK(m_evmcHost->get_storage(EVMHost::convertToEVMC(contract), evmc::bytes32{}) == evmc::bytes32{7});
+
+		BOOST_REQUIRE_EQUAL(numLogs(), 1);
+		BOOST_CHECK(logAddress(0) == contract);
+		BOOST_CHECK(logData(0) == encodeArgs(7));
+
+		// Continue from the restored state.
+		m_contractAddress = contract;
+		ABI_CHECK(callContractFunction("x()"), encodeArgs(7));
+		ABI_CHECK(callContractFunctionWithValue("set(uint256)", 1, u256(8)), encodeArgs());
+		ABI_CHECK(callContractFunction("x()"), encodeArgs(8));
+		BOOST_CHECK_EQUAL(balanceAt(contract), 16);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(reset_starts_at_genesis)
+{
+	compileAndRun(sourceCode);
+	ABI_CHECK(callContractFunctionWithValue("set(uint256)", 0, u256(7)), encodeArgs());
+	BOOST_REQUIRE(blockNumber() > 0);
+	BOOST_REQUIRE_EQUAL(numLogs(), 1);
+
+	reset();
+	BOOST_CHECK_EQUAL(blockNumber(), 0);
+	BOOST_CHECK_EQUAL(currentTimestamp(), 0);
+	BOOST_CHECK_EQUAL(numLogs(), 0);
+	BOOST_CHECK(!addressHasCode(m_contractAddress));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -61,6 +61,8 @@ SemanticTest::SemanticTest(
 	m_enforceGasCost(_enforceGasCost),
 	m_enforceGasCostMinValue(_enforceGasCostMinValue)
 {
+	m_useCompilationCache = true;
+
 	string choice = m_reader.stringSetting("compileViaYul", "default");
 	if (choice == "also")
 	{
@@ -117,8 +119,7 @@ SemanticTest::SemanticTest(
 
 	if (m_enforceGasCost)
 	{
-		m_compiler.setMetadataFormat(CompilerStack::MetadataFormat::NoMetadata);
-		m_compiler.setMetadataHash(CompilerStack::MetadataHash::None);
+		m_metadataFormat = CompilerStack::MetadataFormat::NoMetadata;
 	}
 }
 
@@ -194,6 +195,7 @@ TestCase::TestResult SemanticTest::runTest(
 			soltestAssert(
 				deploy(test.call().signature, 0, {}, libraries) && m_transactionSuccessful,
 				"Failed to deploy library " + test.call().signature);
+			recordGasUsed("library: " + test.call().signature, true);
 			libraries[test.call().signature] = m_contractAddress;
 			continue;
 		}
@@ -203,6 +205,7 @@ TestCase::TestResult SemanticTest::runTest(
 				deploy("", test.call().value.value, test.call().arguments.rawBytes(), libraries);
 			else
 				soltestAssert(deploy("", 0, bytes(), libraries), "Failed to deploy contract.");
+			recordGasUsed("constructor", true);
 			constructed = true;
 		}
 
@@ -229,7 +232,10 @@ TestCase::TestResult SemanticTest::runTest(
 		{
 			bytes output;
 			if (test.call().kind == FunctionCall::Kind::LowLevel)
+			{
 				output = callLowLevel(test.call().arguments.rawBytes(), test.call().value.value);
+				recordGasUsed("<low-level call>", false);
+			}
 			else if (test.call().kind == FunctionCall::Kind::Builtin)
 			{
 				std::optional<bytes> builtinOutput = m_builtins.at(test.call().signature)(test.call());
@@ -245,7 +251,7 @@ TestCase::TestResult SemanticTest::runTest(
 			{
 				soltestAssert(
 					m_allowNonExistingFunctions ||
-					m_compiler.methodIdentifiers(m_compiler.lastContractName()).isMember(test.call().signature),
+					compiledMethodIdentifiers().isMember(test.call().signature),
 					"The function " + test.call().signature + " is not known to the compiler"
 				);
 
@@ -254,6 +260,7 @@ TestCase::TestResult SemanticTest::runTest(
 					test.call().value.value,
 					test.call().arguments.rawBytes()
 				);
+				recordGasUsed(test.call().signature, false);
 			}
 
 			bool outputMismatch = (output != test.call().expectations.rawBytes());
@@ -272,7 +279,7 @@ TestCase::TestResult SemanticTest::runTest(
 
 			test.setFailure(!m_transactionSuccessful);
 			test.setRawBytes(std::move(output));
-			test.setContractABI(m_compiler.contractABI(m_compiler.lastContractName()));
+			test.setContractABI(compiledContractABI());
 		}
 	}
 
@@ -363,6 +370,38 @@ bool SemanticTest::checkGasCostExpectation(TestFunctionCall& io_test, bool _comp
 		m_gasUsed == io_test.call().expectations.gasUsed.at(setting);
 }
 
+void SemanticTest::recordGasUsed(string _transaction, bool _deployment)
+{
+	if (!m_gasMeasurements)
+		return;
+
+	size_t codeSize = 0;
+	if (_deployment && m_transactionSuccessful)
+		codeSize = m_evmcHost->get_code_size(solidity::test::EVMHost::convertToEVMC(m_contractAddress));
+	m_gasMeasurements->push_back({std::move(_transaction), m_gasUsed, _deployment, codeSize});
+}
+
+std::optional<vector<SemanticTest::GasMeasurement>> SemanticTest::measureGas(
+	ostream& _stream,
+	bool _compileViaYul,
+	OptimiserSettings const& _optimiserSettings
+)
+{
+	soltestAssert(supportsCodeGenerator(_compileViaYul), "");
+
+	m_optimiserSettings = _optimiserSettings;
+	// The metadata hash depends on the compiler version and would affect the gas costs.
+	m_metadataFormat = CompilerStack::MetadataFormat::NoMetadata;
+	m_gasMeasurements.emplace();
+	TestResult result = runTest(_stream, "", false, _compileViaYul, false);
+	std::optional<vector<GasMeasurement>> measurements = std::move(m_gasMeasurements);
+	m_gasMeasurements.reset();
+
+	if (result != TestResult::Success)
+		return nullopt;
+	return measurements;
+}
+
 void SemanticTest::printSource(ostream& _stream, string const& _linePrefix, bool _formatted) const
 {
 	if (m_sources.sources.empty())
@@ -23,6 +23,7 @@
 #include <libsolutil/AnsiColorized.h>
 
 #include <iosfwd>
+#include <optional>
 #include <string>
 #include <vector>
 #include <utility>
@@ -39,6 +40,19 @@ namespace solidity::frontend::test
 class SemanticTest: public SolidityExecutionFramework, public EVMVersionRestrictedTestCase
 {
 public:
+	/// Gas used by one transaction of a test run.
+	struct GasMeasurement
+	{
+		/// The called function, "constructor" for the deployment of the contract
+		/// or "library: <name>" for the deployment of a library.
+		std::string transaction;
+		u256 gasUsed;
+		/// True for the deployment of a contract or library, also if it failed.
+		bool deployment = false;
+		/// Size of the deployed code for successful deployments, zero otherwise.
+		size_t codeSize = 0;
+	};
+
 	static std::unique_ptr<TestCase> create(Config const& _options)
 	{
 		return std::make_unique<SemanticTest>(
@@ -75,9 +89,26 @@ public:
 	/// Returns true if deployment was successful, false otherwise.
 	bool deploy(std::string const& _contractName, u256 const& _value, bytes const& _arguments, std::map<std::string, solidity::test::Address> const& _libraries = {});
 
+	/// @returns true if the test can be run with the IR code generator if @a _compileViaYul
+	/// is set or with the legacy code generator otherwise.
+	bool supportsCodeGenerator(bool _compileViaYul) const { return _compileViaYul ? m_runWithYul : m_runWithoutYul; }
+
+	/// Runs the test compiled without metadata, with the given code generator and optimiser
+	/// settings, and records the gas used by every deployment and function call.
+	/// Gas expectations are not checked.
+	/// @returns the measurements in the order of the transactions or nullopt if the test failed,
+	/// in which case the details are written to @a _stream.
+	std::optional<std::vector<GasMeasurement>> measureGas(
+		std::ostream& _stream,
+		bool _compileViaYul,
+		OptimiserSettings const& _optimiserSettings
+	);
+
 private:
 	TestResult runTest(std::ostream& _stream, std::string const& _linePrefix, bool _formatted, bool _compileViaYul, bool _compileToEwasm);
 	bool checkGasCostExpectation(TestFunctionCall& io_test, bool _compileViaYul) const;
+	/// Records the gas used by the last transaction if gas is being measured.
+	void recordGasUsed(std::string _transaction, bool _deployment);
 	SourceMap m_sources;
 	std::size_t m_lineOffset;
 	std::vector<TestFunctionCall> m_tests;
@@ -93,6 +124,8 @@ private:
 	bool m_gasCostFailure = false;
 	bool m_enforceGasCost = false;
 	u256 m_enforceGasCostMinValue;
+	/// Set while gas is being measured by @a measureGas.
+	std::optional<std::vector<GasMeasurement>> m_gasMeasurements;
 };
 
 }
@@ -27,6 +27,8 @@
 #include <test/libsolidity/SolidityExecutionFramework.h>
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/SourceReferenceFormatter.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
 
 using namespace solidity;
 using namespace solidity::test;
@@ -44,6 +46,25 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	for (auto& entry: sourcesWithPreamble)
 		entry.second = addPreamble(entry.second);
 
+	m_cachedCompilation.reset();
+	optional<CompilationCache> cache;
+	util::h256 cacheKey;
+	// Compiling via IR also checks that the generated Yul code can be parsed again, which must
+	// not be skipped.
+	if (
+		m_useCompilationCache &&
+		!m_compileViaYul &&
+		!m_showMetadata &&
+		!solidity::test::CommonOptions::get().compilationCache.empty()
+	)
+	{
+		cache.emplace(solidity::test::CommonOptions::get().compilationCache);
+		cacheKey = compilationCacheKey(sourcesWithPreamble, _contractName, _libraryAddresses);
+		m_cachedCompilation = cache->lookup(cacheKey);
+		if (m_cachedCompilation)
+			return m_cachedCompilation->bytecode;
+	}
+
 	m_compiler.reset();
 	m_compiler.enableEwasmGeneration(m_compileToEwasm);
 	m_compiler.setSources(sourcesWithPreamble);
@@ -54,6 +75,8 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	m_compiler.enableEvmBytecodeGeneration(!m_compileViaYul);
 	m_compiler.enableIRGeneration(m_compileViaYul);
 	m_compiler.setRevertStringBehaviour(m_revertStrings);
+	if (m_metadataFormat)
+		m_compiler.setMetadataFormat(*m_metadataFormat);
 	if (!m_compiler.compile())
 	{
 		// The testing framework expects an exception for
@@ -115,9 +138,70 @@ bytes SolidityExecutionFramework::multiSourceCompileContract(
 	BOOST_REQUIRE(obj.linkReferences.empty());
 	if (m_showMetadata)
 		cout << "metadata: " << m_compiler.metadata(contractName) << endl;
+	m_compiledContractName = contractName;
+	if (cache)
+	{
+		m_cachedCompilation = CompilationCache::Entry{
+			obj.bytecode,
+			m_compiler.contractABI(contractName),
+			m_compiler.methodIdentifiers(contractName)
+		};
+		cache->store(cacheKey, *m_cachedCompilation);
+	}
 	return obj.bytecode;
 }
 
+Json::Value SolidityExecutionFramework::compiledContractABI() const
+{
+	if (m_cachedCompilation)
+		return m_cachedCompilation->abi;
+	return m_compiler.contractABI(m_compiledContractName);
+}
+
+Json::Value SolidityExecutionFramework::compiledMethodIdentifiers() const
+{
+	if (m_cachedCompilation)
+		return m_cachedCompilation->methodIdentifiers;
+	return m_compiler.methodIdentifiers(m_compiledContractName);
+}
+
+util::h256 SolidityExecutionFramework::compilationCacheKey(
+	map<string, string> const& _sourcesWithPreamble,
+	string const& _contractName,
+	map<string, Address> const& _libraryAddresses
+) const
+{
+	Json::Value key{Json::objectValue};
+	key["build"] = CompilationCache::buildIdentifier();
+	key["sources"] = Json::objectValue;
+	for (auto const& [name, source]: _sourcesWithPreamble)
+		key["sources"][name] = source;
+	key["contractName"] = _contractName;
+	key["libraries"] = Json::objectValue;
+	for (auto const& [name, address]: _libraryAddresses)
+		key["libraries"][name] = address.hex();
+	key["evmVersion"] = m_evmVersion.name();
+	key["revertStrings"] = revertStringsToString(m_revertStrings);
+	key["viaYul"] = m_compileViaYul;
+	key["ewasm"] = m_compileToEwasm;
+	key["metadataFormat"] = m_metadataFormat ? static_cast<int>(*m_metadataFormat) : -1;
+
+	Json::Value& optimiser = key["optimiser"];
+	optimiser["orderLiterals"] = m_optimiserSettings.runOrderLiterals;
+	optimiser["inliner"] = m_optimiserSettings.runInliner;
+	optimiser["jumpdestRemover"] = m_optimiserSettings.runJumpdestRemover;
+	optimiser["peephole"] = m_optimiserSettings.runPeephole;
+	optimiser["deduplicate"] = m_optimiserSettings.runDeduplicate;
+	optimiser["cse"] = m_optimiserSettings.runCSE;
+	optimiser["constantOptimiser"] = m_optimiserSettings.runConstantOptimiser;
+	optimiser["optimizeStackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
+	optimiser["yul"] = m_optimiserSettings.runYulOptimiser;
+	optimiser["yulSteps"] = m_optimiserSettings.yulOptimiserSteps;
+	optimiser["runs"] = Json::UInt64(m_optimiserSettings.expectedExecutionsPerDeployment);
+
+	return util::keccak256(util::jsonCompactPrint(key));
+}
+
 bytes SolidityExecutionFramework::compileContract(
 	string const& _sourceCode,
 	string const& _contractName,
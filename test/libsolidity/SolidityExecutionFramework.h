@@ -32,6 +32,10 @@
 
 #include <libyul/AssemblyStack.h>
 
+#include <test/libsolidity/util/CompilationCache.h>
+
+#include <optional>
+
 namespace solidity::frontend::test
 {
 
@@ -72,13 +76,38 @@ public:
 	/// Returns @param _sourceCode prefixed with the version pragma and the abi coder v1 pragma,
 	/// the latter only if it is forced.
 	static std::string addPreamble(std::string const& _sourceCode);
+
+	/// @returns the ABI of the last compiled contract, also if it was taken from the cache.
+	Json::Value compiledContractABI() const;
+	/// @returns the method identifiers of the last compiled contract, also if it was taken
+	/// from the cache.
+	Json::Value compiledMethodIdentifiers() const;
 protected:
+	/// @returns the key of the compilation cache for compiling the contract with the
+	/// current settings.
+	util::h256 compilationCacheKey(
+		std::map<std::string, std::string> const& _sourcesWithPreamble,
+		std::string const& _contractName,
+		std::map<std::string, solidity::test::Address> const& _libraryAddresses
+	) const;
 
 	solidity::frontend::CompilerStack m_compiler;
 	bool m_compileViaYul = false;
 	bool m_compileToEwasm = false;
 	bool m_showMetadata = false;
 	RevertStrings m_revertStrings = RevertStrings::Default;
+	/// Metadata format to compile with, the default of the compiler if not set.
+	std::optional<CompilerStack::MetadataFormat> m_metadataFormat;
+	/// If true, compiled contracts are looked up in and stored into the on-disk compilation
+	/// cache, unless it is disabled on the command line. After a cache hit, only the bytecode,
+	/// the ABI and the method identifiers of the contract are available, not m_compiler.
+	bool m_useCompilationCache = false;
+
+private:
+	/// Name of the last compiled contract.
+	std::string m_compiledContractName;
+	/// Result of the last compilation if the compilation cache was used.
+	std::optional<CompilationCache::Entry> m_cachedCompilation;
 };
 
 } // end namespaces
@@ -27,6 +27,7 @@
 #include <libsolidity/interface/Version.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Profiler.h>
 #include <test/Metadata.h>
 
 #include <algorithm>
@@ -1268,6 +1269,47 @@ BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 }
 
 
+BOOST_AUTO_TEST_CASE(metadata_without_compilation_of_other_contract)
+{
+	// NOTE: the contract A here should fail to compile due to "out of stack"
+	// If no error is reported, that means only B was compiled.
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"outputSelection": {
+				"fileA": {
+					"A": [ "metadata" ],
+					"B": [ "evm.bytecode.object" ]
+				}
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A {
+  function x(uint a, uint b, uint c, uint d, uint e, uint f, uint g, uint h, uint i, uint j, uint k, uint l, uint m, uint n, uint o, uint p) pure public {}
+  function y() pure public {
+    uint a; uint b; uint c; uint d; uint e; uint f; uint g; uint h; uint i; uint j; uint k; uint l; uint m; uint n; uint o; uint p;
+    x(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+  }
+}
+contract B {}"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contractA = getContractResult(result, "fileA", "A");
+	BOOST_CHECK(contractA.isObject());
+	BOOST_CHECK(contractA["metadata"].isString());
+	BOOST_CHECK(!contractA.isMember("evm"));
+	Json::Value contractB = getContractResult(result, "fileA", "B");
+	BOOST_CHECK(contractB.isObject());
+	BOOST_CHECK(contractB["evm"]["bytecode"]["object"].isString());
+	BOOST_CHECK(!contractB["evm"]["bytecode"]["object"].asString().empty());
+}
+
 BOOST_AUTO_TEST_CASE(license_in_metadata)
 {
 	string const input = R"(
@@ -1665,6 +1707,46 @@ BOOST_AUTO_TEST_CASE(stopAfter_ast_output)
 	BOOST_CHECK(result["sources"]["a.sol"]["ast"].isObject());
 }
 
+BOOST_AUTO_TEST_CASE(profiling_per_compilation)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"a.sol": {
+				"content": "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\ncontract C {}"
+			}
+		},
+		"settings": {
+			"stopAfter": "parsing",
+			"profiling": true
+		}
+	}
+	)";
+	// The profiler is shared by the whole process, so every compilation has to start a new recording.
+	for (size_t i = 0; i < 2; ++i)
+	{
+		Json::Value result = compile(input);
+		BOOST_CHECK(containsAtMostWarnings(result));
+		BOOST_REQUIRE(result["profiling"].isObject());
+		BOOST_CHECK_EQUAL(result["profiling"]["calls"].asUInt(), 1);
+		Json::Value const& phases = result["profiling"]["children"];
+		BOOST_REQUIRE(phases.isArray());
+		BOOST_REQUIRE_EQUAL(phases.size(), 2);
+		BOOST_CHECK_EQUAL(phases[0]["name"].asString(), "parsing");
+		BOOST_CHECK_EQUAL(phases[0]["calls"].asUInt(), 1);
+		BOOST_CHECK_EQUAL(phases[1]["name"].asString(), "JSON output");
+		BOOST_CHECK_EQUAL(phases[1]["calls"].asUInt(), 1);
+		BOOST_CHECK(!util::Profiler::enabled());
+	}
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+	parsedInput["settings"].removeMember("profiling");
+	Json::Value result = compile(util::jsonCompactPrint(parsedInput));
+	BOOST_CHECK(!result.isMember("profiling"));
+}
+
 BOOST_AUTO_TEST_CASE(dependency_tracking_of_abstract_contract)
 {
 	char const* input = R"(
@@ -0,0 +1,12 @@
+library L {
+    function f(uint x) internal pure returns (uint) { return x; }
+}
+contract A {
+    using L for uint;
+    function g(uint x) public pure returns (uint) { return x.f(); }
+}
+contract B {
+    function g(uint x) public pure returns (uint) { return x.f(); }
+}
+// ----
+// TypeError 9582: (257-260): Member "f" not found or not visible after argument-dependent lookup in uint256.
@@ -0,0 +1,14 @@
+contract test {
+    uint x;
+    function f() public {
+        x = 1;
+        {
+            x = 2;
+            bool x;
+            x = true;
+        }
+        x = 3;
+    }
+}
+// ----
+// Warning 2519: (110-116): This declaration shadows an existing declaration.
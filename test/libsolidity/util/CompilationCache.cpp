@@ -0,0 +1,147 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/libsolidity/util/CompilationCache.h>
+
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/dll/runtime_symbol_info.hpp>
+
+#include <cerrno>
+#include <fstream>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend::test;
+
+namespace fs = boost::filesystem;
+
+optional<CompilationCache::Entry> CompilationCache::lookup(h256 const& _key) const
+{
+	fs::path path = entryPath(_key);
+	boost::system::error_code error;
+	if (!fs::exists(path, error))
+		return nullopt;
+
+	Json::Value json;
+	try
+	{
+		if (!jsonParseStrict(readFileAsString(path.string()), json) || !json.isObject())
+			return nullopt;
+	}
+	catch (FileNotFound const&)
+	{
+		return nullopt;
+	}
+
+	if (!json["bytecode"].isString() || !json["abi"].isArray() || !json["methodIdentifiers"].isObject())
+		return nullopt;
+	return Entry{fromHex(json["bytecode"].asString()), json["abi"], json["methodIdentifiers"]};
+}
+
+void CompilationCache::store(h256 const& _key, Entry const& _entry) const
+{
+	Json::Value json{Json::objectValue};
+	json["bytecode"] = toHex(_entry.bytecode);
+	json["abi"] = _entry.abi;
+	json["methodIdentifiers"] = _entry.methodIdentifiers;
+
+	boost::system::error_code error;
+	fs::create_directories(m_directory, error);
+	if (error)
+		return;
+
+	fs::path temporaryPath = m_directory / fs::unique_path("%%%%-%%%%-%%%%-%%%%.tmp", error);
+	if (error)
+		return;
+	{
+		ofstream file(temporaryPath.string(), ios::binary);
+		file << jsonCompactPrint(json);
+		if (!file)
+		{
+			file.close();
+			fs::remove(temporaryPath, error);
+			return;
+		}
+	}
+	fs::rename(temporaryPath, entryPath(_key), error);
+	if (error)
+		fs::remove(temporaryPath, error);
+}
+
+bool CompilationCache::prepareDirectory(fs::path const& _directory)
+{
+	boost::system::error_code error;
+	fs::path directory = fs::absolute(_directory, fs::current_path(error));
+	if (error)
+		return false;
+#ifndef _WIN32
+	fs::create_directories(directory.parent_path(), error);
+	if (error)
+		return false;
+	// Create it with restrictive permissions right away, so that nobody else can write into it
+	// in the meantime.
+	if (::mkdir(directory.string().c_str(), S_IRWXU) != 0 && errno != EEXIST)
+		return false;
+
+	struct stat status;
+	if (::lstat(directory.string().c_str(), &status) != 0)
+		return false;
+	return
+		S_ISDIR(status.st_mode) &&
+		status.st_uid == ::geteuid() &&
+		(status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+#else
+	fs::create_directories(directory, error);
+	return !error && fs::is_directory(directory, error);
+#endif
+}
+
+string const& CompilationCache::buildIdentifier()
+{
+	static string const identifier = []() -> string {
+		boost::system::error_code error;
+		fs::path executable = boost::dll::program_location(error);
+		uintmax_t size = error ? 0 : fs::file_size(executable, error);
+		time_t modificationTime = error ? 0 : fs::last_write_time(executable, error);
+		if (error)
+			// Without a way to recognize the build, entries are not reused across runs.
+			return fs::unique_path().string();
+		return
+			frontend::VersionStringStrict + "\n" +
+			executable.string() + "\n" +
+			to_string(size) + "\n" +
+			to_string(modificationTime);
+	}();
+	return identifier;
+}
+
+fs::path CompilationCache::entryPath(h256 const& _key) const
+{
+	return m_directory / (_key.hex() + ".json");
+}
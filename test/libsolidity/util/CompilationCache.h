@@ -0,0 +1,76 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/FixedHash.h>
+
+#include <json/json.h>
+
+#include <boost/filesystem.hpp>
+
+#include <optional>
+#include <string>
+
+namespace solidity::frontend::test
+{
+
+/**
+ * On-disk cache of the results of compiling a contract, stored as one JSON file per key in
+ * a directory. Keys have to cover everything the result depends on; @a buildIdentifier
+ * provides the part that identifies the compiler.
+ *
+ * The directory has to be private to the current user, see @a prepareDirectory, because
+ * entries are used without further checks. The cache can be shared by concurrently running
+ * processes: entries are written to a temporary file first and then renamed. Failures to read or write entries are ignored,
+ * so that a broken cache only costs compilation time.
+ */
+class CompilationCache
+{
+public:
+	struct Entry
+	{
+		bytes bytecode;
+		Json::Value abi;
+		Json::Value methodIdentifiers;
+	};
+
+	explicit CompilationCache(boost::filesystem::path _directory): m_directory(std::move(_directory)) {}
+
+	/// @returns the entry stored for @a _key, if any.
+	std::optional<Entry> lookup(util::h256 const& _key) const;
+	/// Stores @a _entry for @a _key, replacing any previous entry.
+	void store(util::h256 const& _key, Entry const& _entry) const;
+
+	/// Creates @a _directory, accessible only to the current user, if it does not exist yet.
+	/// @returns false if it could not be created or if it can be modified by other users, who
+	/// could then plant entries in the cache.
+	static bool prepareDirectory(boost::filesystem::path const& _directory);
+
+	/// @returns a string that changes whenever the running executable, which contains the
+	/// compiler, is rebuilt.
+	static std::string const& buildIdentifier();
+
+private:
+	boost::filesystem::path entryPath(util::h256 const& _key) const;
+
+	boost::filesystem::path m_directory;
+};
+
+}
@@ -21,16 +21,79 @@
  */
 
 #include <libsolutil/JSON.h>
+#include <libsolutil/CommonIO.h>
 
 #include <test/Common.h>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <memory>
+#include <sstream>
+
 using namespace std;
 
 namespace solidity::util::test
 {
 
+namespace
+{
+
+struct ParseResult
+{
+	bool accepted = false;
+	bool threw = false;
+	string errors;
+	Json::Value value;
+};
+
+/// Parses @a _input with jsonParseStrict or, if @a _reference is true, with the jsoncpp reader
+/// in strict mode only, which jsonParseStrict falls back to for documents it does not handle itself.
+ParseResult parseStrict(string const& _input, bool _reference)
+{
+	ParseResult result;
+	try
+	{
+		if (_reference)
+		{
+			Json::CharReaderBuilder builder;
+			Json::CharReaderBuilder::strictMode(&builder.settings_);
+			unique_ptr<Json::CharReader> reader(builder.newCharReader());
+			result.accepted = reader->parse(
+				_input.c_str(),
+				_input.c_str() + _input.length(),
+				&result.value,
+				&result.errors
+			);
+		}
+		else
+			result.accepted = jsonParseStrict(_input, result.value, &result.errors);
+	}
+	catch (Json::Exception const&)
+	{
+		result.threw = true;
+	}
+	return result;
+}
+
+/// Checks that jsonParseStrict treats @a _input exactly like the jsoncpp reader in strict mode.
+void checkSameAsJsoncpp(string const& _input)
+{
+	BOOST_TEST_CONTEXT("Input: " << _input.substr(0, 100))
+	{
+		ParseResult result = parseStrict(_input, false);
+		ParseResult reference = parseStrict(_input, true);
+		BOOST_CHECK_EQUAL(result.threw, reference.threw);
+		BOOST_CHECK_EQUAL(result.accepted, reference.accepted);
+		BOOST_CHECK_EQUAL(result.errors, reference.errors);
+		// Json::Value only considers values of the same type equal, e.g. no intValue and uintValue.
+		if (result.accepted && reference.accepted)
+			BOOST_CHECK(result.value == reference.value);
+	}
+}
+
+}
+
 BOOST_AUTO_TEST_SUITE(JsonTest, *boost::unit_test::label("nooptions"))
 
 BOOST_AUTO_TEST_CASE(json_pretty_print)
@@ -105,6 +168,159 @@ BOOST_AUTO_TEST_CASE(parse_json_strict)
 	BOOST_CHECK(json[0] == "\x80\xec\x80");
 }
 
+BOOST_AUTO_TEST_CASE(parse_json_strict_fast_path)
+{
+	vector<string> inputs{
+		"{}",
+		"[]",
+		" \t\r\n{ \"a\" : [ 1 , 2 ] , \"b\" : { } } \n",
+		"[true,false,null]",
+		"[tru]",
+		"[nul]",
+		"[1,]",
+		"{\"a\":1,}",
+		"{\"a\" 1}",
+		"[1 2]",
+		"",
+		"   ",
+		"1",
+		"\"a\"",
+		"[1]]",
+		// Leading zeros.
+		"[0]",
+		"[-0]",
+		"[01]",
+		"[-01]",
+		"[00]",
+		"[-]",
+		"[1.5]",
+		"[1e3]",
+		"[1E3]",
+		"[-1.0e-3]",
+		// Limits of int64 and uint64.
+		"[9223372036854775807]",
+		"[9223372036854775808]",
+		"[-9223372036854775807]",
+		"[-9223372036854775808]",
+		"[-9223372036854775809]",
+		"[18446744073709551615]",
+		"[18446744073709551616]",
+		"[99999999999999999999999]",
+		"[-99999999999999999999999]",
+		// Strings and escape sequences.
+		"[\"\"]",
+		"[\"abc\"]",
+		"[\"abc]",
+		"[\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"]",
+		"[\"\\x\"]",
+		"[\"\\u12\"]",
+		"[\"\\uZZZZ\"]",
+		"[\"\\u0041\\u00e9\\u20AC\"]",
+		"[\"\\u0000\"]",
+		"[\"\x80\xec\x80\"]",
+		"[\"\x7f\"]",
+		// Control characters.
+		"[\"a\tb\"]",
+		"[\"a\nb\"]",
+		"[\"\x01\"]",
+		"[\"\x1f\"]",
+		// Paired and lone surrogates.
+		"[\"\\ud83d\\ude00\"]",
+		"[\"\\uD83D\\uDE00\"]",
+		"[\"\\ud83d\"]",
+		"[\"\\ud83dx\"]",
+		"[\"\\ud83d\\u0041\"]",
+		"[\"\\ud83d\\ud83d\"]",
+		"[\"\\ude00\"]",
+		"[\"\\ude00\\ud83d\"]",
+		// Comments.
+		"[1 // comment\n]",
+		"[/* comment */ 1]",
+		"{\"a\": /* comment */ 1}",
+		"{\"a\": 1 // comment\n}",
+		"// comment\n{}",
+		"{} // comment",
+		// Byte order mark.
+		"\xEF\xBB\xBF{}",
+		"\xEF\xBB\xBF[1]",
+		// Duplicate keys.
+		"{\"a\":1,\"a\":2}",
+		"{\"\":1,\"\":2}",
+		"{\"a\":1,\"b\":{\"a\":1}}",
+		"{\"a\":1,\"\\u0061\":2}",
+	};
+	// Nesting depth around the limits of both the fast path and the jsoncpp reader.
+	for (size_t depth: vector<size_t>{10, 899, 900, 901, 902, 998, 999, 1000, 1001, 1002, 2000})
+	{
+		inputs.emplace_back(string(depth, '[') + string(depth, ']'));
+		string objects;
+		for (size_t i = 0; i < depth; ++i)
+			objects += "{\"a\":";
+		inputs.emplace_back(objects + "1" + string(depth, '}'));
+	}
+
+	for (string const& input: inputs)
+		checkSameAsJsoncpp(input);
+}
+
+BOOST_AUTO_TEST_CASE(parse_json_strict_fast_path_corpus)
+{
+	// Standard JSON inputs and outputs and AST exports.
+	size_t files = 0;
+	for (string directory: {"cmdlineTests", "libsolidity/ASTJSON"})
+	{
+		boost::filesystem::path path = solidity::test::CommonOptions::get().testPath / directory;
+		if (!boost::filesystem::is_directory(path))
+			continue;
+		for (auto const& entry: boost::filesystem::recursive_directory_iterator(path))
+			if (boost::filesystem::is_regular_file(entry) && entry.path().extension() == ".json")
+			{
+				checkSameAsJsoncpp(readFileAsString(entry.path().string()));
+				++files;
+			}
+	}
+	BOOST_CHECK(files > 0);
+}
+
+BOOST_AUTO_TEST_CASE(json_stream_writer)
+{
+	Json::Value json;
+	json["a"] = 1;
+	json["b"]["b.1"] = Json::arrayValue;
+	json["b"]["b.2"]["x"] = "y";
+	json["b"]["b.3"] = Json::objectValue;
+	json["b"]["b.4"] = Json::arrayValue;
+	json["b"]["b.4"].append(1);
+	json["b"]["b.4"].append(Json::objectValue);
+	json["b"]["b.4"][1]["z"] = true;
+	json["c"] = Json::objectValue;
+	json["d"] = "d";
+
+	for (bool pretty: {false, true})
+	{
+		stringstream stream;
+		JsonStreamWriter writer(stream, pretty);
+		writer.beginObject();
+		writer.writeMember("a", json["a"]);
+		writer.beginObject("b");
+		writer.writeMember("b.1", json["b"]["b.1"]);
+		writer.beginObject("b.2");
+		writer.writeMember("x", "y");
+		writer.endObject();
+		writer.beginObject("b.3");
+		writer.endObject();
+		writer.writeMember("b.4", json["b"]["b.4"]);
+		writer.endObject();
+		writer.beginObject("c");
+		writer.endObject();
+		writer.beginObject("cc", true);
+		writer.endObject();
+		writer.writeMember("d", "d");
+		writer.endObject();
+		BOOST_CHECK_EQUAL(stream.str(), pretty ? jsonPrettyPrint(json) : jsonCompactPrint(json));
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
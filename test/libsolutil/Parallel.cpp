@@ -0,0 +1,73 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ParallelTests, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(default_thread_count_is_positive)
+{
+	BOOST_CHECK(defaultThreadCount() >= 1);
+}
+
+BOOST_AUTO_TEST_CASE(every_index_is_processed_once)
+{
+	for (size_t threads: {1u, 2u, 4u, 32u})
+		for (size_t count: {0u, 1u, 3u, 100u})
+		{
+			vector<atomic<unsigned>> calls(count);
+			parallelFor(count, threads, [&](size_t _index) { ++calls[_index]; });
+			for (atomic<unsigned> const& callCount: calls)
+				BOOST_CHECK_EQUAL(callCount.load(), 1);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(exception_of_lowest_index_is_rethrown)
+{
+	vector<atomic<bool>> called(50);
+	try
+	{
+		parallelFor(called.size(), 4, [&](size_t _index) {
+			called[_index] = true;
+			if (_index % 10 == 7)
+				throw runtime_error(to_string(_index));
+		});
+		BOOST_FAIL("Expected an exception.");
+	}
+	catch (runtime_error const& _error)
+	{
+		BOOST_CHECK_EQUAL(string(_error.what()), "7");
+	}
+	for (atomic<bool> const& wasCalled: called)
+		BOOST_CHECK(wasCalled.load());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
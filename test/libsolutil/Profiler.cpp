@@ -0,0 +1,282 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for Profiler.h.
+ */
+
+#include <libsolutil/Profiler.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ProfilerTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(timers_do_nothing_when_not_started)
+{
+	BOOST_REQUIRE(!Profiler::enabled());
+	{
+		ScopedTimer timer{"a"};
+	}
+	Profiler::start();
+	Profiler::Phase root = Profiler::stop();
+	BOOST_CHECK(root.children.empty());
+	BOOST_CHECK(!Profiler::enabled());
+}
+
+BOOST_AUTO_TEST_CASE(nesting)
+{
+	Profiler::start();
+	{
+		ScopedTimer a{"a"};
+		{
+			ScopedTimer b{"b"};
+			ScopedTimer c{"c"};
+		}
+		ScopedTimer d{"d"};
+	}
+	{
+		ScopedTimer e{"e"};
+	}
+	Profiler::Phase root = Profiler::stop();
+
+	BOOST_CHECK_EQUAL(root.name, "");
+	BOOST_CHECK_EQUAL(root.count, 1);
+	BOOST_REQUIRE_EQUAL(root.children.size(), 2);
+	Profiler::Phase const& a = root.children[0];
+	BOOST_CHECK_EQUAL(a.name, "a");
+	BOOST_REQUIRE_EQUAL(a.children.size(), 2);
+	BOOST_CHECK_EQUAL(a.children[0].name, "b");
+	BOOST_REQUIRE_EQUAL(a.children[0].children.size(), 1);
+	BOOST_CHECK_EQUAL(a.children[0].children[0].name, "c");
+	BOOST_CHECK_EQUAL(a.children[1].name, "d");
+	BOOST_CHECK(a.children[1].children.empty());
+	BOOST_CHECK_EQUAL(root.children[1].name, "e");
+	BOOST_CHECK(root.children[1].children.empty());
+
+	BOOST_CHECK(a.duration >= a.children[0].duration + a.children[1].duration);
+	BOOST_CHECK(root.duration >= a.duration + root.children[1].duration);
+}
+
+BOOST_AUTO_TEST_CASE(repeated_phases_are_merged)
+{
+	Profiler::start();
+	for (size_t i = 0; i < 3; ++i)
+	{
+		ScopedTimer outer{"outer"};
+		for (size_t j = 0; j < 2; ++j)
+		{
+			ScopedTimer step{"step"};
+		}
+		ScopedTimer other{"other"};
+	}
+	// Same name, but a different parent.
+	{
+		ScopedTimer step{"step"};
+	}
+	Profiler::Phase root = Profiler::stop();
+
+	BOOST_REQUIRE_EQUAL(root.children.size(), 2);
+	Profiler::Phase const& outer = root.children[0];
+	BOOST_CHECK_EQUAL(outer.name, "outer");
+	BOOST_CHECK_EQUAL(outer.count, 3);
+	BOOST_REQUIRE_EQUAL(outer.children.size(), 2);
+	BOOST_CHECK_EQUAL(outer.children[0].name, "step");
+	BOOST_CHECK_EQUAL(outer.children[0].count, 6);
+	BOOST_CHECK_EQUAL(outer.children[1].name, "other");
+	BOOST_CHECK_EQUAL(outer.children[1].count, 3);
+	BOOST_CHECK_EQUAL(root.children[1].name, "step");
+	BOOST_CHECK_EQUAL(root.children[1].count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(start_discards_earlier_recordings)
+{
+	Profiler::start();
+	{
+		ScopedTimer timer{"first"};
+	}
+	BOOST_CHECK_EQUAL(Profiler::stop().children.size(), 1);
+
+	Profiler::start();
+	{
+		ScopedTimer timer{"second"};
+	}
+	Profiler::Phase root = Profiler::stop();
+	BOOST_REQUIRE_EQUAL(root.children.size(), 1);
+	BOOST_CHECK_EQUAL(root.children[0].name, "second");
+	BOOST_CHECK_EQUAL(root.children[0].count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(timers_of_earlier_recordings_are_ignored)
+{
+	Profiler::start();
+	optional<ScopedTimer> stale;
+	stale.emplace("stale");
+	Profiler::start();
+	{
+		ScopedTimer timer{"fresh"};
+	}
+	// Ends after the restart, so it must neither be recorded nor change the active phase.
+	stale.reset();
+	{
+		ScopedTimer timer{"fresh"};
+	}
+	Profiler::Phase root = Profiler::stop();
+	BOOST_REQUIRE_EQUAL(root.children.size(), 1);
+	BOOST_CHECK_EQUAL(root.children[0].name, "fresh");
+	BOOST_CHECK_EQUAL(root.children[0].count, 2);
+	BOOST_CHECK(root.children[0].children.empty());
+}
+
+BOOST_AUTO_TEST_CASE(phases_of_other_threads_are_sub_phases_of_the_root)
+{
+	Profiler::start();
+	{
+		ScopedTimer timer{"main"};
+		thread worker([]() { ScopedTimer workerTimer{"worker"}; });
+		worker.join();
+	}
+	Profiler::Phase root = Profiler::stop();
+	BOOST_REQUIRE_EQUAL(root.children.size(), 2);
+	BOOST_CHECK_EQUAL(root.children[0].name, "main");
+	BOOST_CHECK(root.children[0].children.empty());
+	BOOST_CHECK_EQUAL(root.children[1].name, "worker");
+}
+
+BOOST_AUTO_TEST_CASE(to_json)
+{
+	Profiler::Phase child{"child", chrono::microseconds(1500), 2, 4096, {}};
+	Profiler::Phase root{"", chrono::milliseconds(3), 1, 8192, {child}};
+	Json::Value json = Profiler::toJson(root);
+
+	BOOST_CHECK_EQUAL(json["name"].asString(), "");
+	BOOST_CHECK_EQUAL(json["durationMicroseconds"].asUInt64(), 3000);
+	BOOST_CHECK_EQUAL(json["calls"].asUInt64(), 1);
+	BOOST_CHECK_EQUAL(json["peakMemoryIncrease"].asUInt64(), 8192);
+	BOOST_REQUIRE(json["children"].isArray());
+	BOOST_REQUIRE_EQUAL(json["children"].size(), 1);
+	Json::Value const& childJson = json["children"][0];
+	BOOST_CHECK_EQUAL(childJson["name"].asString(), "child");
+	BOOST_CHECK_EQUAL(childJson["durationMicroseconds"].asUInt64(), 1500);
+	BOOST_CHECK_EQUAL(childJson["calls"].asUInt64(), 2);
+	BOOST_CHECK_EQUAL(childJson["peakMemoryIncrease"].asUInt64(), 4096);
+	BOOST_CHECK(!childJson.isMember("children"));
+}
+
+BOOST_AUTO_TEST_CASE(format_table)
+{
+	Profiler::Phase grandchild{"grandchild", chrono::milliseconds(1), 4, 0, {}};
+	Profiler::Phase child{"child", chrono::milliseconds(2), 2, 2048, {grandchild}};
+	Profiler::Phase root{"", chrono::milliseconds(8), 1, 4096, {child}};
+	string expectation =
+		"Phase              Time (ms)    Share    Calls    Memory (KiB)\n"
+		"total                  8.000   100.0%        1               4\n"
+		"  child                2.000    25.0%        2               2\n"
+		"    grandchild         1.000    12.5%        4               0\n";
+	BOOST_CHECK_EQUAL(Profiler::formatTable(root), expectation);
+}
+
+BOOST_AUTO_TEST_CASE(trace_events_are_recorded_on_request)
+{
+	Profiler::start();
+	{
+		ScopedTimer timer{"a"};
+	}
+	Profiler::stop();
+	BOOST_CHECK(Profiler::traceEvents().empty());
+
+	Profiler::start(true);
+	{
+		ScopedTimer outer{"outer"};
+		for (size_t i = 0; i < 2; ++i)
+		{
+			ScopedTimer inner{"inner"};
+		}
+		thread worker([]() { ScopedTimer workerTimer{"worker"}; });
+		worker.join();
+	}
+	Profiler::stop();
+
+	// Unlike the phases, the runs are not merged and are listed in the order in which they ended.
+	vector<Profiler::TraceEvent> events = Profiler::traceEvents();
+	BOOST_REQUIRE_EQUAL(events.size(), 4);
+	BOOST_CHECK_EQUAL(events[0].name, "inner");
+	BOOST_CHECK_EQUAL(events[1].name, "inner");
+	BOOST_CHECK_EQUAL(events[2].name, "worker");
+	BOOST_CHECK_EQUAL(events[3].name, "outer");
+	BOOST_CHECK_EQUAL(events[0].thread, 1);
+	BOOST_CHECK_EQUAL(events[1].thread, 1);
+	BOOST_CHECK_EQUAL(events[2].thread, 2);
+	BOOST_CHECK_EQUAL(events[3].thread, 1);
+	BOOST_CHECK(events[0].start + events[0].duration <= events[1].start);
+	Profiler::TraceEvent const& outer = events[3];
+	for (size_t i = 0; i < 3; ++i)
+	{
+		BOOST_CHECK(events[i].start >= outer.start);
+		BOOST_CHECK(events[i].start + events[i].duration <= outer.start + outer.duration);
+	}
+
+	Profiler::start(true);
+	Profiler::stop();
+	BOOST_CHECK(Profiler::traceEvents().empty());
+}
+
+BOOST_AUTO_TEST_CASE(to_trace_json)
+{
+	vector<Profiler::TraceEvent> events{
+		{"inner", chrono::microseconds(20), chrono::nanoseconds(1500), 1},
+		{"outer", chrono::microseconds(10), chrono::microseconds(30), 1},
+		{"worker", chrono::microseconds(12), chrono::microseconds(5), 2}
+	};
+	Json::Value json = Profiler::toTraceJson(events);
+
+	BOOST_CHECK_EQUAL(json["displayTimeUnit"].asString(), "ms");
+	BOOST_REQUIRE(json["traceEvents"].isArray());
+	BOOST_REQUIRE_EQUAL(json["traceEvents"].size(), 3);
+	for (Json::ArrayIndex i = 0; i < json["traceEvents"].size(); ++i)
+	{
+		Json::Value const& event = json["traceEvents"][i];
+		BOOST_CHECK_EQUAL(event["name"].asString(), events[i].name);
+		// Complete events, which have a duration instead of separate begin and end events.
+		BOOST_CHECK_EQUAL(event["ph"].asString(), "X");
+		BOOST_CHECK_EQUAL(event["pid"].asInt(), 1);
+		BOOST_CHECK_EQUAL(event["tid"].asUInt64(), events[i].thread);
+		BOOST_CHECK(event["ts"].isDouble());
+		BOOST_CHECK(event["dur"].isDouble());
+	}
+	// Times are in microseconds.
+	BOOST_CHECK_EQUAL(json["traceEvents"][0]["ts"].asDouble(), 20.0);
+	BOOST_CHECK_EQUAL(json["traceEvents"][0]["dur"].asDouble(), 1.5);
+	BOOST_CHECK_EQUAL(json["traceEvents"][1]["ts"].asDouble(), 10.0);
+	BOOST_CHECK_EQUAL(json["traceEvents"][1]["dur"].asDouble(), 30.0);
+	BOOST_CHECK_EQUAL(json["traceEvents"][2]["tid"].asUInt64(), 2);
+
+	BOOST_CHECK(Profiler::toTraceJson({})["traceEvents"].empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -18,7 +18,7 @@
 
 #include <test/libyul/EwasmTranslationTest.h>
 
-#include <test/tools/yulInterpreter/Interpreter.h>
+#include <tools/yulInterpreter/Interpreter.h>
 
 #include <test/Common.h>
 
@@ -18,7 +18,8 @@
 
 #include <test/libyul/YulInterpreterTest.h>
 
-#include <test/tools/yulInterpreter/Interpreter.h>
+#include <tools/yulInterpreter/CompiledInterpreter.h>
+#include <tools/yulInterpreter/Interpreter.h>
 
 #include <test/Common.h>
 
@@ -50,6 +51,7 @@ YulInterpreterTest::YulInterpreterTest(string const& _filename):
 	EVMVersionRestrictedTestCase(_filename)
 {
 	m_source = m_reader.source();
+	m_meterGas = m_reader.boolSetting("meterGas", false);
 	m_expectation = m_reader.simpleExpectations();
 }
 
@@ -58,7 +60,11 @@ TestCase::TestResult YulInterpreterTest::run(ostream& _stream, string const& _li
 	if (!parse(_stream, _linePrefix, _formatted))
 		return TestResult::FatalError;
 
-	m_obtainedResult = interpret();
+	m_obtainedResult = interpret(false);
+	// Both interpreters have to produce identical results.
+	string compiledResult = interpret(true);
+	if (compiledResult != m_obtainedResult)
+		m_obtainedResult += "Result of the compiled interpreter differs:\n" + compiledResult;
 
 	return checkResult(_stream, _linePrefix, _formatted);
 }
@@ -84,15 +90,21 @@ bool YulInterpreterTest::parse(ostream& _stream, string const& _linePrefix, bool
 	}
 }
 
-string YulInterpreterTest::interpret()
+string YulInterpreterTest::interpret(bool _compiled)
 {
 	InterpreterState state;
 	state.maxTraceSize = 32;
 	state.maxSteps = 512;
 	state.maxExprNesting = 64;
+	if (m_meterGas)
+		state.gas.emplace(solidity::test::CommonOptions::get().evmVersion());
 	try
 	{
-		Interpreter::run(state, EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{}), *m_ast);
+		Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{});
+		if (_compiled)
+			CompiledInterpreter::run(state, dialect, *m_ast);
+		else
+			Interpreter::run(state, dialect, *m_ast);
 	}
 	catch (InterpreterTerminatedGeneric const&)
 	{
@@ -50,12 +50,16 @@ public:
 
 private:
 	bool parse(std::ostream& _stream, std::string const& _linePrefix, bool const _formatted);
-	std::string interpret();
+	/// Runs the code with Interpreter, or with CompiledInterpreter if @a _compiled is true.
+	/// @returns the trace and the final state.
+	std::string interpret(bool _compiled);
 
 	static void printErrors(std::ostream& _stream, langutil::ErrorList const& _errors);
 
 	std::shared_ptr<Block> m_ast;
 	std::shared_ptr<AsmAnalysisInfo> m_analysisInfo;
+	/// If true, gas is metered for the EVM version the tests are run with and included in the result.
+	bool m_meterGas = false;
 };
 
 }
@@ -64,7 +64,10 @@ IsolTestOptions::IsolTestOptions(std::string* _editor):
 		("help", po::bool_switch(&showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor), "Don't use colors.")
 		("accept-updates", po::bool_switch(&acceptUpdates), "Automatically accept expectation updates.")
-		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
+		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.")
+		("jobs,j", po::value<size_t>(&jobs)->default_value(1), "Run the tests in the given number of worker processes. Implies --non-interactive.")
+		("non-interactive", po::bool_switch(&nonInteractive), "Report failing tests without asking how to proceed.")
+		("stats-file", po::value<std::string>(&statsFile), "Write the number of successful, total and skipped tests to the given file.");
 }
 
 bool IsolTestOptions::parse(int _argc, char const* const* _argv)
@@ -92,6 +95,8 @@ void IsolTestOptions::validate() const
 		ConfigException,
 		"Invalid test unit filter - can only contain '" + filterString + ": " + testFilter
 	);
+	assertThrow(jobs > 0, ConfigException, "The number of jobs must be at least 1.");
+	validateCompilationCache();
 }
 
 }
@@ -33,6 +33,12 @@ struct IsolTestOptions: CommonOptions
 	bool noColor = false;
 	bool acceptUpdates = false;
 	std::string testFilter = std::string{};
+	/// Number of worker processes to distribute the tests across.
+	size_t jobs = 1;
+	/// If set, failing tests are reported without asking how to proceed.
+	bool nonInteractive = false;
+	/// If non-empty, the final test statistics are written to this file.
+	std::string statsFile = std::string{};
 
 	IsolTestOptions(std::string* _editor);
 	bool parse(int _argc, char const* const* _argv) override;
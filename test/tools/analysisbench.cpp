@@ -0,0 +1,175 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmark of the analysis phase: parses and analyses either the given files or a generated
+ * project with a long chain of contracts inheriting from each other and reports the time spent
+ * in name resolution, type checking and the other analysis steps.
+ */
+
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Profiler.h>
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// @returns a project of @a _contracts source units, each of which defines a contract with
+/// @a _members state variables and functions that inherits from the contract of the previous
+/// source unit. The functions use local variables in nested blocks as well as variables and
+/// functions of several base contracts.
+map<string, string> generateProject(size_t _contracts, size_t _members)
+{
+	map<string, string> sources;
+	for (size_t i = 0; i < _contracts; ++i)
+	{
+		string const contract = "C" + to_string(i);
+		string const base = "C" + to_string(i / 2);
+		string source = "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\n";
+		if (i > 0)
+			source += "import \"C" + to_string(i - 1) + ".sol\";\n";
+		source += "contract " + contract + (i > 0 ? " is C" + to_string(i - 1) : "") + " {\n";
+		for (size_t j = 0; j < _members; ++j)
+		{
+			string const suffix = to_string(i) + "_" + to_string(j);
+			string const baseSuffix = to_string(i / 2) + "_" + to_string(j);
+			source += "\tuint v" + suffix + ";\n";
+			source += "\tfunction f" + suffix + "(uint a) public view returns (uint r) {\n";
+			source += "\t\tuint b = a + v" + suffix + ";\n";
+			source += "\t\t{\n";
+			source += "\t\t\tuint c = b + v" + baseSuffix + ";\n";
+			source += "\t\t\tr = c + v" + suffix + " + v" + baseSuffix + ";\n";
+			if (i > 0)
+				source += "\t\t\tr += f" + baseSuffix + "(c) + " + base + ".f" + baseSuffix + "(b);\n";
+			source += "\t\t}\n";
+			source += "\t}\n";
+		}
+		source += "\tfunction g(uint a) public view virtual";
+		source += i > 0 ? " override returns (uint) {\n\t\treturn super.g(a) + " : " returns (uint) {\n\t\treturn a + ";
+		source += "v" + to_string(i) + "_0;\n\t}\n";
+		source += "}\n";
+		sources[contract + ".sol"] = std::move(source);
+	}
+	return sources;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(analysisbench, benchmark of the analysis phase of the compiler.
+Usage: analysisbench [Options] [file...]
+Parses and analyses the given files, which have to contain all imported sources,
+or, if there are none, a generated project with a long inheritance chain, and
+prints the time spent in each step of the analysis.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23
+	);
+	size_t contracts = 100;
+	size_t members = 20;
+	unsigned repetitions = 3;
+	options.add_options()
+		("help", "Show this help screen.")
+		("contracts", po::value<size_t>(&contracts)->default_value(contracts), "Number of contracts in the generated project.")
+		("members", po::value<size_t>(&members)->default_value(members), "Number of state variables and functions per generated contract.")
+		("repeat", po::value<unsigned>(&repetitions)->default_value(repetitions), "Number of runs. The profile of the fastest one is printed.")
+		("print-project", "Print the generated project instead of analysing it.")
+		("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description positionalOptions;
+	positionalOptions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::command_line_parser(argc, argv).options(options).positional(positionalOptions).run(), arguments);
+		po::notify(arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+	if (arguments.count("help") || repetitions == 0)
+	{
+		cout << options << endl;
+		return arguments.count("help") ? 0 : 1;
+	}
+
+	map<string, string> sources;
+	if (!arguments.count("input-file"))
+		sources = generateProject(contracts, members);
+	else
+		for (string const& fileName: arguments["input-file"].as<vector<string>>())
+			try
+			{
+				sources[fileName] = readFileAsString(fileName);
+			}
+			catch (FileNotFound const&)
+			{
+				cerr << "File not found: " << fileName << endl;
+				return 1;
+			}
+
+	if (arguments.count("print-project"))
+	{
+		for (auto const& [name, source]: sources)
+			cout << "==== " << name << " ====" << endl << source << endl;
+		return 0;
+	}
+
+	optional<Profiler::Phase> fastest;
+	for (unsigned i = 0; i < repetitions; ++i)
+	{
+		CompilerStack compiler;
+		compiler.setSources(sources);
+		Profiler::start();
+		bool success = compiler.parseAndAnalyze();
+		Profiler::Phase profile = Profiler::stop();
+		if (!success)
+		{
+			for (auto const& error: compiler.errors())
+				cerr << langutil::SourceReferenceFormatter::formatErrorInformation(*error);
+			return 1;
+		}
+		if (!fastest || profile.duration < fastest->duration)
+			fastest = std::move(profile);
+	}
+
+	cout << Profiler::formatTable(*fastest);
+	return 0;
+}
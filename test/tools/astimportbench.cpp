@@ -0,0 +1,170 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmark of the import of JSON ASTs: measures the time spent parsing the JSON input with
+ * jsoncpp and with util::jsonParseStrict and the time spent converting it into an AST.
+ */
+
+#include <libsolidity/ast/ASTJsonImporter.h>
+
+#include <liblangutil/EVMVersion.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// @returns the time in seconds it took to run @a _function.
+template <typename F>
+double measure(F&& _function)
+{
+	auto start = chrono::steady_clock::now();
+	_function();
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// Parses @a _input with the strict jsoncpp reader on its own, i.e. the reference for
+/// util::jsonParseStrict.
+bool jsoncppParseStrict(string const& _input, Json::Value& _json)
+{
+	Json::CharReaderBuilder builder;
+	Json::CharReaderBuilder::strictMode(&builder.settings_);
+	unique_ptr<Json::CharReader> reader(builder.newCharReader());
+	string errors;
+	return reader->parse(_input.data(), _input.data() + _input.size(), &_json, &errors);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(astimportbench, benchmark of the import of JSON ASTs.
+Usage: astimportbench [Options] file...
+The files have to be in the format accepted by solc --import-ast, e.g. the output of
+solc --combined-json ast.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23
+	);
+	unsigned repetitions = 1;
+	options.add_options()
+		("help", "Show this help screen.")
+		("repeat", po::value<unsigned>(&repetitions)->default_value(1), "Number of times each step is repeated.")
+		("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description positionalOptions;
+	positionalOptions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::command_line_parser(argc, argv).options(options).positional(positionalOptions).run(), arguments);
+		po::notify(arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+	if (arguments.count("help") || !arguments.count("input-file") || repetitions == 0)
+	{
+		cout << options << endl;
+		return arguments.count("help") ? 0 : 1;
+	}
+
+	size_t totalSize = 0;
+	double jsoncppTime = 0;
+	double parseTime = 0;
+	double importTime = 0;
+	for (string const& fileName: arguments["input-file"].as<vector<string>>())
+	{
+		string input;
+		try
+		{
+			input = readFileAsString(fileName);
+		}
+		catch (FileNotFound const&)
+		{
+			cerr << "File not found: " << fileName << endl;
+			return 1;
+		}
+		totalSize += input.size();
+
+		Json::Value reference;
+		Json::Value json;
+		for (unsigned i = 0; i < repetitions; ++i)
+		{
+			bool success = true;
+			jsoncppTime += measure([&]() { success = jsoncppParseStrict(input, reference); });
+			parseTime += measure([&]() { success = success && jsonParseStrict(input, json); });
+			if (!success)
+			{
+				cerr << "Invalid JSON: " << fileName << endl;
+				return 1;
+			}
+		}
+		if (json != reference)
+		{
+			cerr << "Parsers disagree on " << fileName << endl;
+			return 1;
+		}
+
+		map<string, Json::Value> sources;
+		for (string const& sourceName: json["sources"].getMemberNames())
+		{
+			Json::Value& source = json["sources"][sourceName];
+			sources[sourceName] = std::move(source[source.isMember("ast") ? "ast" : "AST"]);
+		}
+		try
+		{
+			for (unsigned i = 0; i < repetitions; ++i)
+				importTime += measure([&]() { ASTJsonImporter(langutil::EVMVersion{}).jsonToSourceUnit(sources); });
+		}
+		catch (std::exception const& _exception)
+		{
+			cerr << "Could not import the ASTs in " << fileName << ": " << _exception.what() << endl;
+			return 1;
+		}
+	}
+
+	cout << fixed << setprecision(3);
+	cout << "Input size:       " << double(totalSize) / 1e6 << " MB" << endl;
+	cout << "jsoncpp parser:   " << jsoncppTime / repetitions << " s" << endl;
+	cout << "jsonParseStrict:  " << parseTime / repetitions << " s" << endl;
+	cout << "AST import:       " << importTime / repetitions << " s" << endl;
+	return 0;
+}
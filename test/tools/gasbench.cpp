@@ -0,0 +1,314 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Gas benchmark: runs a fixed corpus of semantic tests with several code generator and
+ * optimiser settings and reports the gas used by every deployment and call as JSON.
+ */
+
+#include <test/Common.h>
+#include <test/EVMHost.h>
+#include <test/libsolidity/SemanticTest.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/Assertions.h>
+#include <libsolutil/JSON.h>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+using namespace solidity::frontend::test;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+auto const description = R"(gasbench, gas benchmark for the code generated by the compiler.
+Usage: gasbench [Options]
+Runs the semantic tests listed in the corpus file with each of the given settings
+and writes the gas used by every deployment and function call as JSON.
+
+Allowed options)";
+
+/// Code generator and optimiser settings of a benchmark run. The names match those of the
+/// gas expectations in semantic tests.
+struct BenchmarkSetting
+{
+	string name;
+	bool compileViaYul;
+	OptimiserSettings optimiserSettings;
+};
+
+vector<BenchmarkSetting> const& allSettings()
+{
+	static vector<BenchmarkSetting> const settings{
+		{"legacy", false, OptimiserSettings::minimal()},
+		{"legacyOptimized", false, OptimiserSettings::full()},
+		{"ir", true, OptimiserSettings::minimal()},
+		{"irOptimized", true, OptimiserSettings::full()}
+	};
+	return settings;
+}
+
+struct GasBenchOptions: solidity::test::CommonOptions
+{
+	bool showHelp = false;
+	/// File listing the tests to run, one path relative to the test path per line.
+	fs::path corpus;
+	/// If non-empty, the report is written to this file instead of standard output.
+	string outputFile;
+	string settingsString;
+	vector<BenchmarkSetting> settings;
+
+	GasBenchOptions(): CommonOptions(description)
+	{
+		string settingNames;
+		for (BenchmarkSetting const& setting: allSettings())
+			settingNames += (settingNames.empty() ? "" : ",") + setting.name;
+
+		options.add_options()
+			("help", po::bool_switch(&showHelp), "Show this help screen.")
+			("corpus", po::value<fs::path>(&corpus), "File listing the tests to run. Defaults to gasBenchmarkCorpus.txt in the test path.")
+			("output,o", po::value<string>(&outputFile), "Write the report to the given file instead of standard output.")
+			("settings", po::value<string>(&settingsString)->default_value(settingNames), "Comma-separated list of the settings to benchmark.");
+	}
+
+	bool parse(int _argc, char const* const* _argv) override
+	{
+		bool const res = CommonOptions::parse(_argc, _argv);
+		if (showHelp || !res)
+		{
+			cout << options << endl;
+			return false;
+		}
+
+		if (corpus.empty())
+			corpus = testPath / "gasBenchmarkCorpus.txt";
+
+		vector<string> names;
+		boost::split(names, settingsString, boost::is_any_of(","));
+		for (string const& name: names)
+			for (BenchmarkSetting const& setting: allSettings())
+				if (setting.name == boost::trim_copy(name))
+					settings.push_back(setting);
+		assertThrow(
+			settings.size() == names.size(),
+			solidity::test::ConfigException,
+			"Invalid settings: " + settingsString
+		);
+		return res;
+	}
+};
+
+/// @returns the paths of the tests listed in @a _corpus, ignoring empty lines and comments.
+vector<string> readCorpus(fs::path const& _corpus)
+{
+	ifstream file(_corpus.string());
+	assertThrow(file, solidity::test::ConfigException, "Could not read corpus file " + _corpus.string());
+
+	vector<string> tests;
+	string line;
+	while (getline(file, line))
+	{
+		boost::trim(line);
+		if (!line.empty() && line.front() != '#')
+			tests.emplace_back(std::move(line));
+	}
+	return tests;
+}
+
+/// Runs @a _test with @a _setting and @returns the report of the run. Sets @a _failed if
+/// the test did not pass.
+Json::Value runSetting(SemanticTest& _test, BenchmarkSetting const& _setting, bool& _failed)
+{
+	Json::Value report{Json::objectValue};
+	stringstream errors;
+	std::optional<vector<SemanticTest::GasMeasurement>> measurements;
+	try
+	{
+		measurements = _test.measureGas(errors, _setting.compileViaYul, _setting.optimiserSettings);
+	}
+	catch (std::exception const& _exception)
+	{
+		errors << _exception.what() << endl;
+	}
+	catch (...)
+	{
+		errors << "Unknown exception." << endl;
+	}
+
+	if (!measurements)
+	{
+		_failed = true;
+		cerr << errors.str() << endl;
+		report["failed"] = true;
+		return report;
+	}
+
+	u256 deploymentGas;
+	u256 callGas;
+	size_t codeSize = 0;
+	report["transactions"] = Json::arrayValue;
+	for (SemanticTest::GasMeasurement const& measurement: *measurements)
+	{
+		Json::Value transaction{Json::objectValue};
+		transaction["transaction"] = measurement.transaction;
+		transaction["gasUsed"] = measurement.gasUsed.str();
+		if (measurement.deployment)
+		{
+			transaction["codeSize"] = Json::UInt64(measurement.codeSize);
+			deploymentGas += measurement.gasUsed;
+			codeSize += measurement.codeSize;
+		}
+		else
+			callGas += measurement.gasUsed;
+		report["transactions"].append(std::move(transaction));
+	}
+	report["deploymentGas"] = deploymentGas.str();
+	report["callGas"] = callGas.str();
+	report["codeSize"] = Json::UInt64(codeSize);
+	return report;
+}
+
+/// Adds the totals of @a _report, the report of a single test and setting, to @a _totals.
+void addToTotals(Json::Value& _totals, Json::Value const& _report)
+{
+	if (_report.isMember("failed"))
+		return;
+	if (_totals.isNull())
+	{
+		_totals["tests"] = 0;
+		_totals["deploymentGas"] = "0";
+		_totals["callGas"] = "0";
+		_totals["codeSize"] = 0;
+	}
+	_totals["tests"] = _totals["tests"].asUInt() + 1;
+	for (char const* key: {"deploymentGas", "callGas"})
+		_totals[key] = (u256(_totals[key].asString()) + u256(_report[key].asString())).str();
+	_totals["codeSize"] = _totals["codeSize"].asUInt64() + _report["codeSize"].asUInt64();
+}
+
+}
+
+int main(int argc, char const* argv[])
+{
+	try
+	{
+		auto options = make_unique<GasBenchOptions>();
+		if (!options->parse(argc, argv))
+			return -1;
+		options->validate();
+		solidity::test::CommonOptions::setSingleton(std::move(options));
+	}
+	catch (std::exception const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	auto const& options = dynamic_cast<GasBenchOptions const&>(solidity::test::CommonOptions::get());
+
+	vector<string> tests;
+	try
+	{
+		if (!solidity::test::EVMHost::checkVmPaths(options.vmPaths))
+		{
+			cerr << "No evmc vm could be found. Use the --vm argument." << endl;
+			return 1;
+		}
+		tests = readCorpus(options.corpus);
+	}
+	catch (std::exception const& _exception)
+	{
+		cerr << "Error: " << _exception.what() << endl;
+		return 1;
+	}
+
+	// The version differs between any two builds, so it is not part of the report, which is meant
+	// to be compared between builds.
+	cerr << "Compiler version: " << VersionString << endl;
+
+	Json::Value report{Json::objectValue};
+	report["evmVersion"] = options.evmVersion().name();
+	report["tests"] = Json::objectValue;
+	report["totals"] = Json::objectValue;
+
+	bool failed = false;
+	for (string const& testName: tests)
+	{
+		cerr << testName << endl;
+		unique_ptr<SemanticTest> test;
+		try
+		{
+			test = make_unique<SemanticTest>(
+				(options.testPath / testName).string(),
+				options.evmVersion(),
+				options.vmPaths
+			);
+		}
+		catch (std::exception const& _exception)
+		{
+			cerr << "Error loading " << testName << ": " << _exception.what() << endl;
+			failed = true;
+			continue;
+		}
+		if (!test->shouldRun())
+		{
+			cerr << "Skipping " << testName << ", which does not run with the given options." << endl;
+			continue;
+		}
+
+		Json::Value& testReport = report["tests"][testName];
+		testReport = Json::objectValue;
+		for (BenchmarkSetting const& setting: options.settings)
+			if (test->supportsCodeGenerator(setting.compileViaYul))
+			{
+				testReport[setting.name] = runSetting(*test, setting, failed);
+				addToTotals(report["totals"][setting.name], testReport[setting.name]);
+			}
+	}
+
+	if (options.outputFile.empty())
+		cout << jsonPrettyPrint(report) << endl;
+	else
+	{
+		ofstream file(options.outputFile, ios::trunc);
+		file << jsonPrettyPrint(report) << endl;
+		if (!file)
+		{
+			cerr << "Could not write " << options.outputFile << endl;
+			return 1;
+		}
+	}
+
+	return failed ? 1 : 0;
+}
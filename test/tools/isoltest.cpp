@@ -25,10 +25,13 @@
 #include <test/InteractiveTests.h>
 #include <test/EVMHost.h>
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/process.hpp>
 
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <queue>
 #include <regex>
@@ -47,6 +50,7 @@ using namespace solidity::util::formatting;
 
 namespace po = boost::program_options;
 namespace fs = boost::filesystem;
+namespace bp = boost::process;
 
 using TestCreator = TestCase::TestCaseCreator;
 using TestOptions = solidity::test::IsolTestOptions;
@@ -126,6 +130,7 @@ public:
 private:
 	enum class Request
 	{
+		Continue,
 		Skip,
 		Rerun,
 		Quit
@@ -233,6 +238,9 @@ TestTool::Request TestTool::handleResponse(bool _exception)
 		return Request::Rerun;
 	}
 
+	if (m_options.nonInteractive)
+		return Request::Continue;
+
 	if (_exception)
 		cout << "(e)dit/(s)kip/(q)uit? ";
 	else
@@ -294,7 +302,13 @@ TestStats TestTool::processPath(
 				fs::directory_iterator(fullpath),
 				fs::directory_iterator()
 			))
-				if (fs::is_directory(entry.path()) || TestCase::isTestFilename(entry.path().filename()))
+				if (
+					fs::is_directory(entry.path()) ||
+					(
+						TestCase::isTestFilename(entry.path().filename()) &&
+						_options.isInShard((currentPath / entry.path().filename()).generic_path().string())
+					)
+				)
 					paths.push(currentPath / entry.path().filename());
 		}
 		else if (m_exitRequested)
@@ -319,6 +333,9 @@ TestStats TestTool::processPath(
 			case Result::Exception:
 				switch(testTool.handleResponse(result == Result::Exception))
 				{
+				case Request::Continue:
+					paths.pop();
+					break;
 				case Request::Quit:
 					paths.pop();
 					m_exitRequested = true;
@@ -415,6 +432,126 @@ std::optional<TestStats> runTestSuite(
 	return stats;
 }
 
+void printSummary(TestStats const& _stats, bool _formatted)
+{
+	cout << endl << "Summary: ";
+	AnsiColorized(cout, _formatted, {BOLD, _stats ? GREEN : RED}) <<
+		 _stats.successCount << "/" << _stats.testCount;
+	cout << " tests successful";
+	if (_stats.skippedCount > 0)
+	{
+		cout << " (";
+		AnsiColorized(cout, _formatted, {BOLD, YELLOW}) << _stats.skippedCount;
+		cout << " tests skipped)";
+	}
+	cout << "." << endl;
+}
+
+void writeStats(TestStats const& _stats, string const& _path)
+{
+	ofstream file(_path, ios::trunc);
+	file << _stats.successCount << " " << _stats.testCount << " " << _stats.skippedCount << endl;
+}
+
+optional<TestStats> readStats(fs::path const& _path)
+{
+	TestStats stats;
+	ifstream file(_path.string());
+	if (file >> stats.successCount >> stats.testCount >> stats.skippedCount)
+		return stats;
+	return nullopt;
+}
+
+/// @returns the command line arguments without the options that are set differently for each
+/// worker process.
+vector<string> workerArguments(int _argc, char const* const* _argv)
+{
+	static vector<string> const valueOptions{"--jobs", "-j", "--shard", "--stats-file"};
+
+	vector<string> arguments;
+	for (int i = 1; i < _argc; ++i)
+	{
+		string argument = _argv[i];
+		bool skipped = false;
+		for (string const& option: valueOptions)
+			if (argument == option)
+			{
+				// The value is the next argument.
+				++i;
+				skipped = true;
+			}
+			else if (
+				boost::starts_with(argument, option + "=") ||
+				(option.size() == 2 && boost::starts_with(argument, option))
+			)
+				skipped = true;
+		if (!skipped)
+			arguments.emplace_back(std::move(argument));
+	}
+	return arguments;
+}
+
+/// Runs the tests in @a _options.jobs child processes, each running a different shard of the
+/// shard selected in @a _options. The output of each worker is captured and printed in worker
+/// order once all of them have finished, so that the result does not depend on scheduling.
+int runWorkers(int _argc, char const* const* _argv, solidity::test::IsolTestOptions const& _options)
+{
+	fs::path executable = _argv[0];
+	if (!executable.has_parent_path())
+		executable = bp::search_path(executable);
+
+	fs::path outputDirectory = fs::temp_directory_path() / fs::unique_path("isoltest-%%%%-%%%%-%%%%");
+	fs::create_directories(outputDirectory);
+
+	size_t const shardCount = _options.shardCount * _options.jobs;
+	vector<bp::child> workers;
+	for (size_t i = 0; i < _options.jobs; ++i)
+	{
+		// The worker shards partition the shard that was requested for this process.
+		size_t const shardIndex = _options.shardIndex + _options.shardCount * i;
+		vector<string> arguments = workerArguments(_argc, _argv);
+		arguments += vector<string>{
+			"--shard", to_string(shardIndex) + "/" + to_string(shardCount),
+			"--stats-file", (outputDirectory / ("stats" + to_string(i))).string()
+		};
+		if (!_options.nonInteractive)
+			arguments.emplace_back("--non-interactive");
+
+		workers.emplace_back(
+			executable,
+			bp::args(arguments),
+			(bp::std_out & bp::std_err) > (outputDirectory / ("output" + to_string(i))).string(),
+			bp::std_in < bp::null
+		);
+	}
+
+	TestStats globalStats;
+	bool workersSucceeded = true;
+	for (size_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].wait();
+
+		cout << "--- Worker " << i + 1 << "/" << workers.size() << " ---" << endl;
+		ifstream output((outputDirectory / ("output" + to_string(i))).string());
+		cout << output.rdbuf() << endl;
+
+		if (optional<TestStats> stats = readStats(outputDirectory / ("stats" + to_string(i))))
+			globalStats += *stats;
+		else
+		{
+			cerr << "Worker " << i + 1 << " exited with code " << workers[i].exit_code() << " without reporting results." << endl;
+			workersSucceeded = false;
+		}
+	}
+	fs::remove_all(outputDirectory);
+
+	printSummary(globalStats, !_options.noColor);
+	if (!_options.statsFile.empty())
+		writeStats(globalStats, _options.statsFile);
+
+	return workersSucceeded && globalStats ? 0 : 1;
+}
+
 }
 
 int main(int argc, char const *argv[])
@@ -441,6 +578,19 @@ int main(int argc, char const *argv[])
 
 	auto& options = dynamic_cast<solidity::test::IsolTestOptions const&>(solidity::test::CommonOptions::get());
 
+	if (options.jobs > 1)
+	{
+		try
+		{
+			return runWorkers(argc, argv, options);
+		}
+		catch (std::exception const& _exception)
+		{
+			cerr << "Error running worker processes: " << _exception.what() << endl;
+			return 1;
+		}
+	}
+
 	bool disableSemantics = true;
 	try
 	{
@@ -481,17 +631,9 @@ int main(int argc, char const *argv[])
 			return 1;
 	}
 
-	cout << endl << "Summary: ";
-	AnsiColorized(cout, !options.noColor, {BOLD, global_stats ? GREEN : RED}) <<
-		 global_stats.successCount << "/" << global_stats.testCount;
-	cout << " tests successful";
-	if (global_stats.skippedCount > 0)
-	{
-		cout << " (";
-		AnsiColorized(cout, !options.noColor, {BOLD, YELLOW}) << global_stats.skippedCount;
-		cout << " tests skipped)";
-	}
-	cout << "." << endl;
+	printSummary(global_stats, !options.noColor);
+	if (!options.statsFile.empty())
+		writeStats(global_stats, options.statsFile);
 
 	if (disableSemantics)
 		cout << "\nNOTE: Skipped semantics tests because no evmc vm could be found.\n" << endl;
@@ -52,7 +52,7 @@ yulFuzzerUtil::TerminationReason yulFuzzerUtil::interpret(
 	TerminationReason reason = TerminationReason::None;
 	try
 	{
-		Interpreter::run(state, _dialect, *_ast);
+		CompiledInterpreter::run(state, _dialect, *_ast);
 	}
 	catch (StepLimitReached const&)
 	{
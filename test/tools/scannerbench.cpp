@@ -0,0 +1,148 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmark of the scanner: measures the throughput of tokenising Solidity sources, e.g. all
+ * files in test/libsolidity/syntaxTests.
+ */
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/Scanner.h>
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::langutil;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+/// @returns the time in seconds it took to run @a _function.
+template <typename F>
+double measure(F&& _function)
+{
+	auto start = chrono::steady_clock::now();
+	_function();
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/// @returns the names of the .sol files in @a _path, which is a file or a directory that is
+/// searched recursively, in a deterministic order.
+vector<string> solidityFiles(fs::path const& _path)
+{
+	if (!fs::is_directory(_path))
+		return {_path.string()};
+	vector<string> files;
+	for (auto const& entry: fs::recursive_directory_iterator(_path))
+		if (fs::is_regular_file(entry) && entry.path().extension() == ".sol")
+			files.push_back(entry.path().string());
+	sort(files.begin(), files.end());
+	return files;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(scannerbench, benchmark of the Solidity scanner.
+Usage: scannerbench [Options] path...
+Each path is a Solidity source file or a directory that is searched recursively for .sol files,
+e.g. test/libsolidity/syntaxTests. The files are tokenised one after the other, so that
+unterminated comments or strings in one file do not affect the others.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23
+	);
+	unsigned repetitions = 1;
+	options.add_options()
+		("help", "Show this help screen.")
+		("repeat", po::value<unsigned>(&repetitions)->default_value(1), "Number of times the corpus is tokenised.")
+		("input-path", po::value<vector<string>>(), "input file or directory");
+	po::positional_options_description positionalOptions;
+	positionalOptions.add("input-path", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::command_line_parser(argc, argv).options(options).positional(positionalOptions).run(), arguments);
+		po::notify(arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+	if (arguments.count("help") || !arguments.count("input-path") || repetitions == 0)
+	{
+		cout << options << endl;
+		return arguments.count("help") ? 0 : 1;
+	}
+
+	vector<shared_ptr<CharStream>> sources;
+	size_t totalSize = 0;
+	for (string const& path: arguments["input-path"].as<vector<string>>())
+		for (string const& fileName: solidityFiles(path))
+		{
+			try
+			{
+				sources.emplace_back(make_shared<CharStream>(util::readFileAsString(fileName), fileName));
+			}
+			catch (util::FileNotFound const&)
+			{
+				cerr << "File not found: " << fileName << endl;
+				return 1;
+			}
+			totalSize += sources.back()->source().size();
+		}
+
+	size_t tokens = 0;
+	double time = measure([&]() {
+		Scanner scanner;
+		for (unsigned i = 0; i < repetitions; ++i)
+			for (shared_ptr<CharStream> const& source: sources)
+			{
+				scanner.reset(source);
+				for (; scanner.currentToken() != Token::EOS; scanner.next())
+					++tokens;
+			}
+	});
+
+	cout << fixed << setprecision(3);
+	cout << "Files:       " << sources.size() << endl;
+	cout << "Input size:  " << double(totalSize) / 1e6 << " MB" << endl;
+	cout << "Tokens:      " << tokens / repetitions << endl;
+	cout << "Time:        " << time / repetitions << " s" << endl;
+	cout << "Throughput:  " << double(totalSize) * repetitions / 1e6 / time << " MB/s" << endl;
+	return 0;
+}
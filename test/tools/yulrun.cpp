@@ -19,7 +19,8 @@
  * Yul interpreter.
  */
 
-#include <test/tools/yulInterpreter/Interpreter.h>
+#include <tools/yulInterpreter/CompiledInterpreter.h>
+#include <tools/yulInterpreter/Interpreter.h>
 
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmParser.h>
@@ -39,8 +40,10 @@
 
 #include <boost/program_options.hpp>
 
+#include <chrono>
 #include <string>
 #include <memory>
+#include <optional>
 #include <iostream>
 
 using namespace std;
@@ -61,10 +64,10 @@ void printErrors(ErrorList const& _errors)
 		SourceReferenceFormatter(cout, true, false).printErrorInformation(*error);
 }
 
-pair<shared_ptr<Block>, shared_ptr<AsmAnalysisInfo>> parse(string const& _source)
+pair<shared_ptr<Block>, shared_ptr<AsmAnalysisInfo>> parse(string const& _source, EVMVersion _evmVersion)
 {
 	AssemblyStack stack(
-		langutil::EVMVersion(),
+		_evmVersion,
 		AssemblyStack::Language::StrictAssembly,
 		solidity::frontend::OptimiserSettings::none()
 	);
@@ -80,26 +83,61 @@ pair<shared_ptr<Block>, shared_ptr<AsmAnalysisInfo>> parse(string const& _source
 	}
 }
 
-void interpret(string const& _source)
+template <typename Run>
+InterpreterState runOnce(Run const& _run, InterpreterState _state)
+{
+	try
+	{
+		_run(_state);
+	}
+	catch (InterpreterTerminatedGeneric const&)
+	{
+	}
+	return _state;
+}
+
+/// Runs the program @a _repetitions times, prints the trace and state of the last run and,
+/// if there was more than one run, the average execution time to stderr.
+/// Unless @a _astInterpreter is set, the program is lowered once and the lowered form is executed.
+/// If @a _meterGas is set, gas is metered according to the rules of @a _evmVersion.
+void interpret(
+	string const& _source,
+	EVMVersion _evmVersion,
+	bool _meterGas,
+	size_t _maxSteps,
+	size_t _repetitions,
+	bool _astInterpreter
+)
 {
 	shared_ptr<Block> ast;
 	shared_ptr<AsmAnalysisInfo> analysisInfo;
-	tie(ast, analysisInfo) = parse(_source);
+	tie(ast, analysisInfo) = parse(_source, _evmVersion);
 	if (!ast || !analysisInfo)
 		return;
 
+	Dialect const& dialect(EVMDialect::strictAssemblyForEVMObjects(_evmVersion));
+	InterpreterState initialState;
+	initialState.maxTraceSize = 10000;
+	initialState.maxSteps = _maxSteps;
+	if (_meterGas)
+		initialState.gas.emplace(_evmVersion);
+
+	auto start = chrono::steady_clock::now();
 	InterpreterState state;
-	state.maxTraceSize = 10000;
-	try
-	{
-		Dialect const& dialect(EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{}));
-		Interpreter::run(state, dialect, *ast);
-	}
-	catch (InterpreterTerminatedGeneric const&)
+	if (_astInterpreter)
+		for (size_t i = 0; i < max<size_t>(_repetitions, 1); ++i)
+			state = runOnce([&](InterpreterState& _state) { Interpreter::run(_state, dialect, *ast); }, initialState);
+	else
 	{
+		CompiledInterpreter interpreter(dialect, *ast);
+		for (size_t i = 0; i < max<size_t>(_repetitions, 1); ++i)
+			state = runOnce([&](InterpreterState& _state) { interpreter.run(_state); }, initialState);
 	}
+	auto duration = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
 
 	state.dumpTraceAndState(cout);
+	if (_repetitions > 1)
+		cerr << "Average execution time: " << duration.count() / static_cast<long long>(_repetitions) << " us" << endl;
 }
 
 }
@@ -116,6 +154,15 @@ Allowed options)",
 		po::options_description::m_default_line_length - 23);
 	options.add_options()
 		("help", "Show this help screen.")
+		("ast-interpreter", "Execute the AST directly instead of lowering it first. Both produce the same results.")
+		(
+			"evm-version",
+			po::value<string>()->value_name("version")->default_value(EVMVersion{}.name()),
+			"Select the EVM version to analyze the code and to meter gas for."
+		)
+		("meter-gas", "Meter the gas used by builtins and print it in total and by function.")
+		("max-steps", po::value<size_t>()->default_value(0), "Stop the execution after the given number of steps (0 means no limit).")
+		("repeat", po::value<size_t>()->default_value(1), "Run the program the given number of times and print the average execution time.")
 		("input-file", po::value<vector<string>>(), "input file");
 	po::positional_options_description filesPositions;
 	filesPositions.add("input-file", -1);
@@ -133,6 +180,13 @@ Allowed options)",
 		return 1;
 	}
 
+	optional<EVMVersion> evmVersion = EVMVersion::fromString(arguments["evm-version"].as<string>());
+	if (!evmVersion)
+	{
+		cerr << "Invalid EVM version: " << arguments["evm-version"].as<string>() << endl;
+		return 1;
+	}
+
 	if (arguments.count("help"))
 		cout << options;
 	else
@@ -154,7 +208,14 @@ Allowed options)",
 		else
 			input = readStandardInput();
 
-		interpret(input);
+		interpret(
+			input,
+			*evmVersion,
+			arguments.count("meter-gas") > 0,
+			arguments["max-steps"].as<size_t>(),
+			arguments["repeat"].as<size_t>(),
+			arguments.count("ast-interpreter") > 0
+		);
 	}
 
 	return 0;
@@ -324,6 +324,7 @@ BOOST_FIXTURE_TEST_CASE(run_should_print_cache_stats_if_requested, AlgorithmRunn
 		BOOST_TEST(nextLineMatches(m_output, regex(R"(Totalhits:\d+)")));
 		BOOST_TEST(nextLineMatches(m_output, regex(R"(Totalmisses:\d+)")));
 		BOOST_TEST(nextLineMatches(m_output, regex(R"(Sizeofcachedcode:\d+)")));
+		BOOST_TEST(nextLineMatches(m_output, regex(R"(Totalevictions:\d+)")));
 	}
 
 	BOOST_REQUIRE(stats.roundEntryCounts.size() == 2);
@@ -338,6 +339,7 @@ BOOST_FIXTURE_TEST_CASE(run_should_print_cache_stats_if_requested, AlgorithmRunn
 	BOOST_TEST(nextLineMatches(m_output, regex("Totalhits:" + toString(stats.hits))));
 	BOOST_TEST(nextLineMatches(m_output, regex("Totalmisses:" + toString(stats.misses))));
 	BOOST_TEST(nextLineMatches(m_output, regex("Sizeofcachedcode:" + toString(stats.totalCodeSize))));
+	BOOST_TEST(nextLineMatches(m_output, regex("Totalevictions:" + toString(stats.evictions))));
 	BOOST_TEST(m_output.peek() == EOF);
 }
 
@@ -380,6 +382,7 @@ BOOST_FIXTURE_TEST_CASE(run_should_print_partial_stats_and_message_if_some_cache
 	BOOST_TEST(nextLineMatches(m_output, regex(R"(Totalhits:\d+)")));
 	BOOST_TEST(nextLineMatches(m_output, regex(R"(Totalmisses:\d+)")));
 	BOOST_TEST(nextLineMatches(m_output, regex(R"(Sizeofcachedcode:\d+)")));
+	BOOST_TEST(nextLineMatches(m_output, regex(R"(Totalevictions:\d+)")));
 	BOOST_TEST(nextLineMatches(m_output, regex(stripWhitespace("Program cache disabled for 1 out of 2 programs"))));
 	BOOST_TEST(m_output.peek() == EOF);
 }
@@ -238,6 +238,59 @@ BOOST_FIXTURE_TEST_CASE(evaluate_should_multiply_the_result_by_scaling_factor, P
 	BOOST_TEST(RelativeProgramSize(m_program, nullptr, 4, m_weights).evaluate(m_chromosome) == round(10000.0 * sizeRatio));
 }
 
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(ProgramGasCostTest)
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_measure_gas_cost_of_the_optimised_program, ProgramBasedMetricFixture)
+{
+	size_t unoptimisedCost = ProgramGasCost(m_program, nullptr, {{}}, 200, m_weights).evaluate(Chromosome(""));
+	size_t optimisedCost = ProgramGasCost(m_program, nullptr, {{}}, 200, m_weights).evaluate(m_chromosome);
+
+	BOOST_TEST(unoptimisedCost > 0);
+	BOOST_TEST(optimisedCost < unoptimisedCost);
+}
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_be_able_to_use_program_cache_if_available, ProgramBasedMetricFixture)
+{
+	size_t fitness = ProgramGasCost(nullopt, m_programCache, {{}}, 200, m_weights).evaluate(m_chromosome);
+
+	BOOST_TEST(fitness == ProgramGasCost(m_optimisedProgram, nullptr, {{}}, 200, m_weights).evaluate(Chromosome("")));
+	BOOST_TEST(m_programCache->size() == m_chromosome.length());
+}
+
+BOOST_FIXTURE_TEST_CASE(evaluate_should_weight_execution_cost_by_expected_executions_per_deployment, ProgramBasedMetricFixture)
+{
+	size_t deploymentCost = ProgramGasCost(m_program, nullptr, {{}}, 0, m_weights).evaluate(m_chromosome);
+	size_t costOneExecution = ProgramGasCost(m_program, nullptr, {{}}, 1, m_weights).evaluate(m_chromosome);
+	size_t costTenExecutions = ProgramGasCost(m_program, nullptr, {{}}, 10, m_weights).evaluate(m_chromosome);
+
+	BOOST_TEST(deploymentCost > 0);
+	BOOST_TEST(costOneExecution > deploymentCost);
+	BOOST_TEST(costTenExecutions - deploymentCost == 10 * (costOneExecution - deploymentCost));
+}
+
+BOOST_AUTO_TEST_CASE(evaluate_should_execute_the_program_with_each_calldata)
+{
+	CharStream loopStream(
+		"{ for { let i := 0 } lt(i, calldataload(0)) { i := add(i, 1) } { mstore(0, i) } }",
+		""
+	);
+	Program loopProgram = get<Program>(Program::load(loopStream));
+	bytes oneIteration(32, 0);
+	oneIteration.back() = 1;
+	bytes tenIterations(32, 0);
+	tenIterations.back() = 10;
+
+	size_t deploymentCost = ProgramGasCost(loopProgram, nullptr, {}, 1, CodeWeights{}).evaluate(Chromosome(""));
+	size_t costOneIteration = ProgramGasCost(loopProgram, nullptr, {oneIteration}, 1, CodeWeights{}).evaluate(Chromosome(""));
+	size_t costTenIterations = ProgramGasCost(loopProgram, nullptr, {tenIterations}, 1, CodeWeights{}).evaluate(Chromosome(""));
+	size_t costBoth = ProgramGasCost(loopProgram, nullptr, {oneIteration, tenIterations}, 1, CodeWeights{}).evaluate(Chromosome(""));
+
+	BOOST_TEST(costOneIteration > deploymentCost);
+	BOOST_TEST(costTenIterations > costOneIteration);
+	BOOST_TEST(costBoth - deploymentCost == (costOneIteration - deploymentCost) + (costTenIterations - deploymentCost));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE(FitnessMetricCombinationTest)
 
@@ -277,6 +330,29 @@ BOOST_FIXTURE_TEST_CASE(FitnessMetricMinimum_evaluate_should_compute_minimum_of_
 	BOOST_TEST(metric.metrics() == m_simpleMetrics);
 }
 
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(ParallelFitnessMetricTest)
+
+BOOST_FIXTURE_TEST_CASE(evaluateAll_should_return_values_of_nested_metric_in_the_order_of_chromosomes, ProgramBasedMetricFixture)
+{
+	vector<Chromosome> chromosomes = {
+		m_chromosome,
+		Chromosome(""),
+		Chromosome("fcCUnDvejsrmV"),
+		m_chromosome,
+		Chromosome("xarrLMVatTO"),
+	};
+	auto nestedMetric = make_shared<ProgramSize>(nullopt, m_programCache, m_weights);
+
+	vector<size_t> expectedFitness;
+	for (auto const& chromosome: chromosomes)
+		expectedFitness.push_back(ProgramSize(m_program, nullptr, m_weights).evaluate(chromosome));
+
+	BOOST_TEST(ParallelFitnessMetric(nestedMetric, 1).evaluateAll(chromosomes) == expectedFitness);
+	BOOST_TEST(ParallelFitnessMetric(nestedMetric, 4).evaluateAll(chromosomes) == expectedFitness);
+	BOOST_TEST(ParallelFitnessMetric(nestedMetric, 4).evaluate(m_chromosome) == expectedFitness[0]);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
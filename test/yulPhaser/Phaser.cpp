@@ -87,6 +87,9 @@ protected:
 		/* metricAggregator = */ MetricAggregatorChoice::Average,
 		/* relativeMetricScale = */ 5,
 		/* chromosomeRepetitions = */ 1,
+		/* expectedExecutionsPerDeployment = */ 200,
+		/* calldata = */ {{}},
+		/* threadCount = */ 1,
 	};
 	CodeWeights const m_weights{};
 };
@@ -235,6 +238,41 @@ BOOST_FIXTURE_TEST_CASE(build_should_set_relative_metric_scale, FitnessMetricFac
 	BOOST_TEST(relativeProgramSizeMetric->fixedPointPrecision() == m_options.relativeMetricScale);
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_set_expected_executions_per_deployment, FitnessMetricFactoryFixture)
+{
+	m_options.metric = MetricChoice::GasCost;
+	m_options.metricAggregator = MetricAggregatorChoice::Average;
+	m_options.expectedExecutionsPerDeployment = 1000;
+	unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(m_options, {m_programs[0]}, {nullptr}, m_weights);
+	BOOST_REQUIRE(metric != nullptr);
+
+	auto averageMetric = dynamic_cast<FitnessMetricAverage*>(metric.get());
+	BOOST_REQUIRE(averageMetric != nullptr);
+	BOOST_REQUIRE(averageMetric->metrics().size() == 1);
+	BOOST_REQUIRE(averageMetric->metrics()[0] != nullptr);
+
+	auto gasCostMetric = dynamic_cast<ProgramGasCost*>(averageMetric->metrics()[0].get());
+	BOOST_REQUIRE(gasCostMetric != nullptr);
+	BOOST_TEST(gasCostMetric->expectedExecutionsPerDeployment() == m_options.expectedExecutionsPerDeployment);
+}
+
+BOOST_FIXTURE_TEST_CASE(build_should_pass_calldata_to_gas_cost_metric, FitnessMetricFactoryFixture)
+{
+	m_options.metric = MetricChoice::GasCost;
+	m_options.metricAggregator = MetricAggregatorChoice::Sum;
+	m_options.calldata = {{}, {0x12, 0x34}};
+	unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(m_options, {m_programs[0]}, {nullptr}, m_weights);
+	BOOST_REQUIRE(metric != nullptr);
+
+	auto sumMetric = dynamic_cast<FitnessMetricSum*>(metric.get());
+	BOOST_REQUIRE(sumMetric != nullptr);
+	BOOST_REQUIRE(sumMetric->metrics().size() == 1);
+
+	auto gasCostMetric = dynamic_cast<ProgramGasCost*>(sumMetric->metrics()[0].get());
+	BOOST_REQUIRE(gasCostMetric != nullptr);
+	BOOST_TEST((gasCostMetric->calldata() == m_options.calldata));
+}
+
 BOOST_FIXTURE_TEST_CASE(build_should_create_metric_for_each_input_program, FitnessMetricFactoryFixture)
 {
 	unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(
@@ -275,6 +313,19 @@ BOOST_FIXTURE_TEST_CASE(build_should_pass_program_caches_to_metrics, FitnessMetr
 	}
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_evaluate_metric_concurrently_if_multiple_threads_requested, FitnessMetricFactoryFixture)
+{
+	m_options.metricAggregator = MetricAggregatorChoice::Sum;
+	m_options.threadCount = 3;
+	unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(m_options, {m_programs[0]}, {nullptr}, m_weights);
+	BOOST_REQUIRE(metric != nullptr);
+
+	auto parallelMetric = dynamic_cast<ParallelFitnessMetric*>(metric.get());
+	BOOST_REQUIRE(parallelMetric != nullptr);
+	BOOST_TEST(parallelMetric->threadCount() == m_options.threadCount);
+	BOOST_TEST(dynamic_cast<FitnessMetricSum*>(parallelMetric->metric().get()) != nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE(PopulationFactoryTest)
 
@@ -385,7 +436,7 @@ BOOST_AUTO_TEST_SUITE(ProgramCacheFactoryTest)
 
 BOOST_FIXTURE_TEST_CASE(build_should_create_cache_for_each_input_program_if_cache_enabled, FixtureWithPrograms)
 {
-	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true};
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true, /* maxTotalCodeSize = */ nullopt};
 	vector<shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
 	assert(m_programs.size() >= 2 && "There must be at least 2 programs for this test to be meaningful");
 
@@ -399,7 +450,7 @@ BOOST_FIXTURE_TEST_CASE(build_should_create_cache_for_each_input_program_if_cach
 
 BOOST_FIXTURE_TEST_CASE(build_should_return_nullptr_for_each_input_program_if_cache_disabled, FixtureWithPrograms)
 {
-	ProgramCacheFactory::Options options{/* programCacheEnabled = */ false};
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ false, /* maxTotalCodeSize = */ nullopt};
 	vector<shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
 	assert(m_programs.size() >= 2 && "There must be at least 2 programs for this test to be meaningful");
 
@@ -408,6 +459,21 @@ BOOST_FIXTURE_TEST_CASE(build_should_return_nullptr_for_each_input_program_if_ca
 		BOOST_TEST(caches[i] == nullptr);
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_split_size_limit_between_input_programs, FixtureWithPrograms)
+{
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true, /* maxTotalCodeSize = */ 1000};
+	vector<shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
+	assert(m_programs.size() == 3);
+
+	BOOST_TEST(caches.size() == m_programs.size());
+	for (size_t i = 0; i < m_programs.size(); ++i)
+	{
+		BOOST_REQUIRE(caches[i] != nullptr);
+		BOOST_TEST(caches[i]->maxTotalCodeSize().has_value());
+		BOOST_TEST(caches[i]->maxTotalCodeSize().value() == 333);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE(ProgramFactoryTest)
 
@@ -24,9 +24,11 @@
 #include <liblangutil/CharStream.h>
 
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/Parallel.h>
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <string>
 #include <set>
 
@@ -59,9 +61,9 @@ protected:
 
 	static set<string> cachedKeys(ProgramCache const& _programCache)
 	{
-		 set<string> keys;
-		for (auto pair = _programCache.entries().begin(); pair != _programCache.entries().end(); ++pair)
-			keys.insert(pair->first);
+		set<string> keys;
+		for (auto const& [steps, entry]: _programCache.entries())
+			keys.insert(steps);
 
 		return keys;
 	}
@@ -76,9 +78,9 @@ BOOST_AUTO_TEST_SUITE(ProgramCacheTest)
 
 BOOST_AUTO_TEST_CASE(CacheStats_operator_plus_should_add_stats_together)
 {
-	CacheStats statsA{11, 12, 13, {{1, 14}, {2, 15}}};
-	CacheStats statsB{21, 22, 23, {{2, 24}, {3, 25}}};
-	CacheStats statsC{32, 34, 36, {{1, 14}, {2, 39}, {3, 25}}};
+	CacheStats statsA{11, 12, 13, {{1, 14}, {2, 15}}, 16};
+	CacheStats statsB{21, 22, 23, {{2, 24}, {3, 25}}, 26};
+	CacheStats statsC{32, 34, 36, {{1, 14}, {2, 39}, {3, 25}}, 42};
 
 	BOOST_CHECK(statsA + statsB == statsC);
 }
@@ -117,6 +119,22 @@ BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_store_programs_for_all_prefixes,
 	BOOST_TEST(toString(*m_programCache.find("IuO")) == toString(programIuO));
 }
 
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_be_usable_from_multiple_threads, ProgramCacheFixture)
+{
+	vector<string> chromosomes = {"IuO", "Iu", "IuOI", "uO", "IuO", "OIu", "I", "IuOu"};
+	vector<string> expectedCode;
+	for (string const& chromosome: chromosomes)
+		expectedCode.push_back(toString(optimisedProgram(m_program, chromosome)));
+
+	vector<string> cachedCode(chromosomes.size());
+	parallelFor(chromosomes.size(), 4, [&](size_t _index) {
+		cachedCode[_index] = toString(m_programCache.optimiseProgram(chromosomes[_index]));
+	});
+
+	BOOST_TEST(cachedCode == expectedCode);
+	BOOST_TEST((cachedKeys(m_programCache) == set<string>{"I", "Iu", "IuO", "IuOI", "IuOu", "u", "uO", "O", "OI", "OIu"}));
+}
+
 BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_repeat_the_chromosome_requested_number_of_times, ProgramCacheFixture)
 {
 	string steps = "IuOIuO";
@@ -252,6 +270,49 @@ BOOST_FIXTURE_TEST_CASE(gatherStats_should_return_cache_statistics, ProgramCache
 	BOOST_CHECK(m_programCache.gatherStats() == expectedStats5);
 }
 
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_evict_least_recently_used_entries_to_stay_within_size_limit, ProgramCacheFixture)
+{
+	size_t sizeA = optimisedProgram(m_program, "a").codeSize(CacheStats::StorageWeights);
+	size_t sizeAc = optimisedProgram(m_program, "ac").codeSize(CacheStats::StorageWeights);
+	size_t sizeAf = optimisedProgram(m_program, "af").codeSize(CacheStats::StorageWeights);
+	size_t sizeF = optimisedProgram(m_program, "f").codeSize(CacheStats::StorageWeights);
+	ProgramCache programCache(m_program, sizeA + sizeAc + max(sizeF, sizeAf));
+
+	programCache.optimiseProgram("ac");
+	programCache.optimiseProgram("f");
+	BOOST_REQUIRE((cachedKeys(programCache) == set<string>{"a", "ac", "f"}));
+	BOOST_TEST(programCache.gatherStats().evictions == 0);
+
+	// Makes "f" the least recently used entry.
+	programCache.optimiseProgram("ac");
+	programCache.optimiseProgram("af");
+
+	BOOST_TEST((cachedKeys(programCache) == set<string>{"a", "ac", "af"}));
+	BOOST_TEST(programCache.gatherStats().evictions == 1);
+	BOOST_TEST(programCache.gatherStats().totalCodeSize == sizeA + sizeAc + sizeAf);
+}
+
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_reuse_longer_prefixes_if_shorter_ones_were_evicted, ProgramCacheFixture)
+{
+	size_t sizeI = optimisedProgram(m_program, "I").codeSize(CacheStats::StorageWeights);
+	size_t sizeIu = optimisedProgram(m_program, "Iu").codeSize(CacheStats::StorageWeights);
+	size_t sizeIuO = optimisedProgram(m_program, "IuO").codeSize(CacheStats::StorageWeights);
+	size_t sizeL = optimisedProgram(m_program, "L").codeSize(CacheStats::StorageWeights);
+	ProgramCache programCache(m_program, sizeIu + sizeIuO + max(sizeI, sizeL));
+
+	programCache.optimiseProgram("IuO");
+	programCache.optimiseProgram("L");
+	BOOST_REQUIRE((cachedKeys(programCache) == set<string>{"Iu", "IuO", "L"}));
+	BOOST_REQUIRE(programCache.gatherStats().hits == 0);
+
+	Program cachedProgram = programCache.optimiseProgram("IuOI");
+
+	BOOST_TEST(toString(cachedProgram) == toString(optimisedProgram(m_program, "IuOI")));
+	// The evicted "I" does not count as a hit.
+	BOOST_TEST(programCache.gatherStats().hits == 2);
+	BOOST_TEST(programCache.gatherStats().misses == 5);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,637 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Yul interpreter that executes a pre-resolved form of the AST.
+ */
+
+#include <tools/yulInterpreter/CompiledInterpreter.h>
+
+#include <tools/yulInterpreter/EVMInstructionInterpreter.h>
+#include <tools/yulInterpreter/EwasmBuiltinInterpreter.h>
+
+#include <libyul/AST.h>
+#include <libyul/Dialect.h>
+#include <libyul/Utilities.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/wasm/WasmDialect.h>
+
+#include <variant>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::yul::test;
+
+struct CompiledInterpreter::CompiledExpression
+{
+	enum class Kind
+	{
+		Literal,
+		/// Literal argument of a builtin, which is not evaluated.
+		LiteralArgument,
+		Variable,
+		BuiltinCall,
+		FunctionCall
+	};
+
+	Kind kind = Kind::Literal;
+	/// Value of a literal.
+	u256 value;
+	/// Slot of a variable in the frame of its function.
+	size_t slot = 0;
+	BuiltinFunction const* builtin = nullptr;
+	CompiledFunction const* function = nullptr;
+	/// The call in the AST, which builtins need for their literal arguments.
+	yul::FunctionCall const* call = nullptr;
+	/// Arguments of a call, in source order.
+	vector<CompiledExpression> arguments;
+};
+
+struct CompiledInterpreter::CompiledBlock
+{
+	vector<CompiledStatement> statements;
+};
+
+struct CompiledInterpreter::CompiledStatement
+{
+	enum class Kind
+	{
+		Expression,
+		Assignment,
+		VariableDeclaration,
+		If,
+		Switch,
+		ForLoop,
+		Break,
+		Continue,
+		Leave,
+		Block,
+		/// Function definitions, which only take a step when executed.
+		Nothing
+	};
+
+	Kind kind = Kind::Nothing;
+	/// The value of an expression statement, assignment or variable declaration, the condition
+	/// of an if statement or a for loop, or the expression of a switch followed by its case values.
+	vector<CompiledExpression> expressions;
+	/// Slots of assigned or declared variables.
+	vector<size_t> slots;
+	/// The body of an if statement, the bodies of the cases of a switch, the pre, body and post
+	/// blocks of a for loop or a nested block.
+	vector<CompiledBlock> blocks;
+};
+
+struct CompiledInterpreter::CompiledFunction
+{
+	/// Name of the function, empty for the top-level block.
+	YulString name;
+	/// Parameters and return variables occupy the first slots of the frame, in this order.
+	size_t parameterCount = 0;
+	size_t returnVariableCount = 0;
+	size_t slotCount = 0;
+	CompiledBlock body;
+};
+
+/**
+ * Lowers the AST, resolving names through a stack of scopes that mirrors the scoping
+ * rules of Yul: variables are visible in the function they are declared in, functions
+ * in the whole block they are defined in, including nested functions.
+ */
+class CompiledInterpreter::Compiler
+{
+public:
+	Compiler(Dialect const& _dialect, vector<unique_ptr<CompiledFunction>>& _functions):
+		m_dialect(_dialect),
+		m_functions(_functions)
+	{}
+
+	void compileFunction(
+		CompiledFunction& _function,
+		vector<TypedName> const& _parameters,
+		vector<TypedName> const& _returnVariables,
+		yul::Block const& _body
+	)
+	{
+		CompiledFunction* outerFunction = m_function;
+		size_t outerFunctionScope = m_functionScope;
+		m_function = &_function;
+		m_functionScope = m_scopes.size();
+
+		m_scopes.emplace_back();
+		for (auto const& parameter: _parameters)
+			declareVariable(parameter.name);
+		for (auto const& returnVariable: _returnVariables)
+			declareVariable(returnVariable.name);
+		_function.parameterCount = _parameters.size();
+		_function.returnVariableCount = _returnVariables.size();
+		_function.body = compileBlock(_body);
+		m_scopes.pop_back();
+
+		m_function = outerFunction;
+		m_functionScope = outerFunctionScope;
+	}
+
+private:
+	struct Scope
+	{
+		map<YulString, size_t> variables;
+		map<YulString, CompiledFunction*> functions;
+	};
+
+	CompiledBlock compileBlock(yul::Block const& _block)
+	{
+		m_scopes.emplace_back();
+		for (auto const& statement: _block.statements)
+			if (auto const* functionDefinition = get_if<FunctionDefinition>(&statement))
+			{
+				m_functions.emplace_back(make_unique<CompiledFunction>());
+				m_functions.back()->name = functionDefinition->name;
+				m_scopes.back().functions[functionDefinition->name] = m_functions.back().get();
+			}
+		CompiledBlock block = compileStatements(_block);
+		m_scopes.pop_back();
+		return block;
+	}
+
+	/// Compiles the statements of @a _block in the current scope.
+	CompiledBlock compileStatements(yul::Block const& _block)
+	{
+		CompiledBlock block;
+		for (auto const& statement: _block.statements)
+			block.statements.emplace_back(std::visit([&](auto const& _statement) {
+				return compile(_statement);
+			}, statement));
+		return block;
+	}
+
+	CompiledStatement compile(ExpressionStatement const& _statement)
+	{
+		CompiledStatement result{CompiledStatement::Kind::Expression, {}, {}, {}};
+		result.expressions.emplace_back(compile(_statement.expression));
+		return result;
+	}
+
+	CompiledStatement compile(Assignment const& _assignment)
+	{
+		yulAssert(_assignment.value, "");
+		CompiledStatement result{CompiledStatement::Kind::Assignment, {}, {}, {}};
+		result.expressions.emplace_back(compile(*_assignment.value));
+		for (auto const& variableName: _assignment.variableNames)
+			result.slots.emplace_back(lookupVariable(variableName.name));
+		return result;
+	}
+
+	CompiledStatement compile(VariableDeclaration const& _declaration)
+	{
+		CompiledStatement result{CompiledStatement::Kind::VariableDeclaration, {}, {}, {}};
+		// The value is compiled first, since the declared variables are not visible in it.
+		if (_declaration.value)
+			result.expressions.emplace_back(compile(*_declaration.value));
+		for (auto const& variable: _declaration.variables)
+			result.slots.emplace_back(declareVariable(variable.name));
+		return result;
+	}
+
+	CompiledStatement compile(If const& _if)
+	{
+		yulAssert(_if.condition, "");
+		CompiledStatement result{CompiledStatement::Kind::If, {}, {}, {}};
+		result.expressions.emplace_back(compile(*_if.condition));
+		result.blocks.emplace_back(compileBlock(_if.body));
+		return result;
+	}
+
+	CompiledStatement compile(Switch const& _switch)
+	{
+		yulAssert(_switch.expression, "");
+		CompiledStatement result{CompiledStatement::Kind::Switch, {}, {}, {}};
+		result.expressions.emplace_back(compile(*_switch.expression));
+		for (auto const& switchCase: _switch.cases)
+		{
+			// The default case has to be last, so it is the only case without a value.
+			if (switchCase.value)
+				result.expressions.emplace_back(compile(*switchCase.value));
+			result.blocks.emplace_back(compileBlock(switchCase.body));
+		}
+		return result;
+	}
+
+	CompiledStatement compile(FunctionDefinition const& _functionDefinition)
+	{
+		compileFunction(
+			*lookupFunction(_functionDefinition.name),
+			_functionDefinition.parameters,
+			_functionDefinition.returnVariables,
+			_functionDefinition.body
+		);
+		return {CompiledStatement::Kind::Nothing, {}, {}, {}};
+	}
+
+	CompiledStatement compile(ForLoop const& _forLoop)
+	{
+		yulAssert(_forLoop.condition, "");
+		CompiledStatement result{CompiledStatement::Kind::ForLoop, {}, {}, {}};
+		// Variables declared in the pre block are visible in the whole loop.
+		m_scopes.emplace_back();
+		result.blocks.emplace_back(compileStatements(_forLoop.pre));
+		result.expressions.emplace_back(compile(*_forLoop.condition));
+		result.blocks.emplace_back(compileBlock(_forLoop.body));
+		result.blocks.emplace_back(compileBlock(_forLoop.post));
+		m_scopes.pop_back();
+		return result;
+	}
+
+	CompiledStatement compile(Break const&)
+	{
+		return {CompiledStatement::Kind::Break, {}, {}, {}};
+	}
+
+	CompiledStatement compile(Continue const&)
+	{
+		return {CompiledStatement::Kind::Continue, {}, {}, {}};
+	}
+
+	CompiledStatement compile(Leave const&)
+	{
+		return {CompiledStatement::Kind::Leave, {}, {}, {}};
+	}
+
+	CompiledStatement compile(yul::Block const& _block)
+	{
+		CompiledStatement result{CompiledStatement::Kind::Block, {}, {}, {}};
+		result.blocks.emplace_back(compileBlock(_block));
+		return result;
+	}
+
+	CompiledExpression compile(yul::Expression const& _expression)
+	{
+		return std::visit([&](auto const& _node) { return compile(_node); }, _expression);
+	}
+
+	CompiledExpression compile(Literal const& _literal)
+	{
+		CompiledExpression result;
+		result.kind = CompiledExpression::Kind::Literal;
+		result.value = valueOfLiteral(_literal);
+		return result;
+	}
+
+	CompiledExpression compile(Identifier const& _identifier)
+	{
+		CompiledExpression result;
+		result.kind = CompiledExpression::Kind::Variable;
+		result.slot = lookupVariable(_identifier.name);
+		return result;
+	}
+
+	CompiledExpression compile(yul::FunctionCall const& _call)
+	{
+		CompiledExpression result;
+		result.call = &_call;
+		result.builtin = m_dialect.builtin(_call.functionName.name);
+		if (result.builtin)
+			result.kind = CompiledExpression::Kind::BuiltinCall;
+		else
+		{
+			result.kind = CompiledExpression::Kind::FunctionCall;
+			result.function = lookupFunction(_call.functionName.name);
+		}
+
+		for (size_t i = 0; i < _call.arguments.size(); ++i)
+			if (result.builtin && !result.builtin->literalArguments.empty() && result.builtin->literalArguments.at(i))
+			{
+				CompiledExpression argument;
+				argument.kind = CompiledExpression::Kind::LiteralArgument;
+				result.arguments.emplace_back(move(argument));
+			}
+			else
+				result.arguments.emplace_back(compile(_call.arguments.at(i)));
+		return result;
+	}
+
+	size_t declareVariable(YulString _name)
+	{
+		yulAssert(m_function, "");
+		size_t slot = m_function->slotCount++;
+		m_scopes.back().variables[_name] = slot;
+		return slot;
+	}
+
+	size_t lookupVariable(YulString _name) const
+	{
+		for (size_t i = m_scopes.size(); i > m_functionScope; --i)
+			if (m_scopes[i - 1].variables.count(_name))
+				return m_scopes[i - 1].variables.at(_name);
+		yulAssert(false, "Variable not found: " + _name.str());
+		return 0;
+	}
+
+	CompiledFunction* lookupFunction(YulString _name) const
+	{
+		for (size_t i = m_scopes.size(); i > 0; --i)
+			if (m_scopes[i - 1].functions.count(_name))
+				return m_scopes[i - 1].functions.at(_name);
+		yulAssert(false, "Function not found: " + _name.str());
+		return nullptr;
+	}
+
+	Dialect const& m_dialect;
+	vector<unique_ptr<CompiledFunction>>& m_functions;
+	vector<Scope> m_scopes;
+	/// Index of the outermost scope of the function that is being compiled.
+	size_t m_functionScope = 0;
+	CompiledFunction* m_function = nullptr;
+};
+
+/**
+ * Executes the lowered code. Values of expressions are passed on a single value stack
+ * and the frames of all active functions share a single vector of slots.
+ */
+class CompiledInterpreter::Executor
+{
+public:
+	Executor(InterpreterState& _state, bool _evm):
+		m_state(_state),
+		m_evm(_evm)
+	{}
+
+	void run(CompiledFunction const& _main)
+	{
+		m_slots.resize(_main.slotCount);
+		execute(_main.body);
+	}
+
+private:
+	void execute(CompiledBlock const& _block)
+	{
+		for (CompiledStatement const& statement: _block.statements)
+		{
+			incrementStep();
+			execute(statement);
+			if (m_state.controlFlowState != ControlFlowState::Default)
+				break;
+		}
+	}
+
+	void execute(CompiledStatement const& _statement)
+	{
+		switch (_statement.kind)
+		{
+		case CompiledStatement::Kind::Expression:
+		{
+			size_t count = evaluateTopLevel(_statement.expressions.front());
+			m_stack.resize(m_stack.size() - count);
+			break;
+		}
+		case CompiledStatement::Kind::Assignment:
+		case CompiledStatement::Kind::VariableDeclaration:
+			if (_statement.expressions.empty())
+				for (size_t slot: _statement.slots)
+					m_slots[m_frame + slot] = 0;
+			else
+			{
+				size_t count = evaluateTopLevel(_statement.expressions.front());
+				yulAssert(count == _statement.slots.size(), "");
+				size_t first = m_stack.size() - count;
+				for (size_t i = 0; i < count; ++i)
+					m_slots[m_frame + _statement.slots[i]] = m_stack[first + i];
+				m_stack.resize(first);
+			}
+			break;
+		case CompiledStatement::Kind::If:
+			if (evaluateSingle(_statement.expressions.front()) != 0)
+				execute(_statement.blocks.front());
+			break;
+		case CompiledStatement::Kind::Switch:
+		{
+			u256 value = evaluateSingle(_statement.expressions.front());
+			for (size_t i = 0; i < _statement.blocks.size(); ++i)
+				if (i + 1 >= _statement.expressions.size() || evaluateSingle(_statement.expressions[i + 1]) == value)
+				{
+					execute(_statement.blocks[i]);
+					break;
+				}
+			break;
+		}
+		case CompiledStatement::Kind::ForLoop:
+			executeForLoop(_statement);
+			break;
+		case CompiledStatement::Kind::Break:
+			m_state.controlFlowState = ControlFlowState::Break;
+			break;
+		case CompiledStatement::Kind::Continue:
+			m_state.controlFlowState = ControlFlowState::Continue;
+			break;
+		case CompiledStatement::Kind::Leave:
+			m_state.controlFlowState = ControlFlowState::Leave;
+			break;
+		case CompiledStatement::Kind::Block:
+			execute(_statement.blocks.front());
+			break;
+		case CompiledStatement::Kind::Nothing:
+			break;
+		}
+	}
+
+	void executeForLoop(CompiledStatement const& _forLoop)
+	{
+		CompiledBlock const& pre = _forLoop.blocks[0];
+		CompiledBlock const& body = _forLoop.blocks[1];
+		CompiledBlock const& post = _forLoop.blocks[2];
+
+		// Like in Interpreter, the statements of the pre block do not take steps.
+		for (CompiledStatement const& statement: pre.statements)
+		{
+			execute(statement);
+			if (m_state.controlFlowState == ControlFlowState::Leave)
+				return;
+		}
+		while (evaluateSingle(_forLoop.expressions.front()) != 0)
+		{
+			// Increment step for each loop iteration for loops with
+			// an empty body and post blocks to prevent a deadlock.
+			if (body.statements.empty() && post.statements.empty())
+				incrementStep();
+
+			m_state.controlFlowState = ControlFlowState::Default;
+			execute(body);
+			if (m_state.controlFlowState == ControlFlowState::Break || m_state.controlFlowState == ControlFlowState::Leave)
+				break;
+
+			m_state.controlFlowState = ControlFlowState::Default;
+			execute(post);
+			if (m_state.controlFlowState == ControlFlowState::Leave)
+				break;
+		}
+		if (m_state.controlFlowState != ControlFlowState::Leave)
+			m_state.controlFlowState = ControlFlowState::Default;
+	}
+
+	/// Evaluates an expression that is not part of another expression and pushes its values.
+	/// @returns the number of values.
+	size_t evaluateTopLevel(CompiledExpression const& _expression)
+	{
+		// The nesting level counts the expressions evaluated as part of a single statement,
+		// but not those in the body of called functions.
+		size_t outerNestingLevel = m_nestingLevel;
+		m_nestingLevel = 0;
+		size_t stackHeight = m_stack.size();
+		evaluate(_expression);
+		m_nestingLevel = outerNestingLevel;
+		return m_stack.size() - stackHeight;
+	}
+
+	u256 evaluateSingle(CompiledExpression const& _expression)
+	{
+		size_t count = evaluateTopLevel(_expression);
+		yulAssert(count == 1, "");
+		u256 value = std::move(m_stack.back());
+		m_stack.pop_back();
+		return value;
+	}
+
+	void evaluate(CompiledExpression const& _expression)
+	{
+		switch (_expression.kind)
+		{
+		case CompiledExpression::Kind::Literal:
+			incrementNestingLevel();
+			m_stack.emplace_back(_expression.value);
+			break;
+		case CompiledExpression::Kind::LiteralArgument:
+			m_stack.emplace_back(0);
+			break;
+		case CompiledExpression::Kind::Variable:
+			incrementNestingLevel();
+			m_stack.emplace_back(m_slots[m_frame + _expression.slot]);
+			break;
+		case CompiledExpression::Kind::BuiltinCall:
+			evaluateArguments(_expression.arguments);
+			callBuiltin(_expression);
+			break;
+		case CompiledExpression::Kind::FunctionCall:
+			evaluateArguments(_expression.arguments);
+			callFunction(*_expression.function);
+			break;
+		}
+	}
+
+	/// Evaluates the arguments from right to left, so that the first argument is on top
+	/// of the stack.
+	void evaluateArguments(vector<CompiledExpression> const& _arguments)
+	{
+		incrementNestingLevel();
+		for (size_t i = _arguments.size(); i > 0; --i)
+			evaluate(_arguments[i - 1]);
+	}
+
+	void callBuiltin(CompiledExpression const& _call)
+	{
+		size_t argumentCount = _call.arguments.size();
+		m_builtinArguments.assign(m_stack.rbegin(), m_stack.rbegin() + static_cast<ptrdiff_t>(argumentCount));
+		m_stack.resize(m_stack.size() - argumentCount);
+
+		if (m_evm)
+			m_stack.emplace_back(EVMInstructionInterpreter(m_state).evalBuiltin(
+				static_cast<BuiltinFunctionForEVM const&>(*_call.builtin),
+				_call.call->arguments,
+				m_builtinArguments
+			));
+		else
+			m_stack.emplace_back(EwasmBuiltinInterpreter(m_state).evalBuiltin(
+				_call.call->functionName.name,
+				_call.call->arguments,
+				m_builtinArguments
+			));
+	}
+
+	void callFunction(CompiledFunction const& _function)
+	{
+		size_t outerFrame = m_frame;
+		size_t frame = m_slots.size();
+		m_slots.resize(frame + _function.slotCount);
+		for (size_t i = 0; i < _function.parameterCount; ++i)
+		{
+			m_slots[frame + i] = std::move(m_stack.back());
+			m_stack.pop_back();
+		}
+
+		YulString outerFunction = m_state.currentFunction;
+		m_state.currentFunction = _function.name;
+		m_frame = frame;
+		m_state.controlFlowState = ControlFlowState::Default;
+		execute(_function.body);
+		m_state.controlFlowState = ControlFlowState::Default;
+		m_frame = outerFrame;
+		m_state.currentFunction = outerFunction;
+
+		for (size_t i = 0; i < _function.returnVariableCount; ++i)
+			m_stack.emplace_back(m_slots[frame + _function.parameterCount + i]);
+		m_slots.resize(frame);
+	}
+
+	void incrementStep()
+	{
+		m_state.numSteps++;
+		if (m_state.maxSteps > 0 && m_state.numSteps >= m_state.maxSteps)
+		{
+			m_state.trace.emplace_back("Interpreter execution step limit reached.");
+			BOOST_THROW_EXCEPTION(StepLimitReached());
+		}
+	}
+
+	void incrementNestingLevel()
+	{
+		m_nestingLevel++;
+		if (m_state.maxExprNesting > 0 && m_nestingLevel > m_state.maxExprNesting)
+		{
+			m_state.trace.emplace_back("Maximum expression nesting level reached.");
+			BOOST_THROW_EXCEPTION(ExpressionNestingLimitReached());
+		}
+	}
+
+	InterpreterState& m_state;
+	bool const m_evm;
+	/// Values of evaluated expressions.
+	vector<u256> m_stack;
+	/// Slots of the frames of all active functions.
+	vector<u256> m_slots;
+	/// Index of the first slot of the frame of the current function.
+	size_t m_frame = 0;
+	size_t m_nestingLevel = 0;
+	/// Reused buffer for the arguments of builtins.
+	vector<u256> m_builtinArguments;
+};
+
+CompiledInterpreter::CompiledInterpreter(Dialect const& _dialect, yul::Block const& _ast):
+	m_main(make_unique<CompiledFunction>())
+{
+	if (dynamic_cast<EVMDialect const*>(&_dialect))
+		m_evm = true;
+	else
+		yulAssert(dynamic_cast<WasmDialect const*>(&_dialect), "Unsupported dialect.");
+
+	Compiler{_dialect, m_functions}.compileFunction(*m_main, {}, {}, _ast);
+}
+
+CompiledInterpreter::~CompiledInterpreter() = default;
+
+void CompiledInterpreter::run(InterpreterState& _state) const
+{
+	Executor{_state, m_evm}.run(*m_main);
+}
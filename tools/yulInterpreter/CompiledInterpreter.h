@@ -0,0 +1,72 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Yul interpreter that executes a pre-resolved form of the AST.
+ */
+
+#pragma once
+
+#include <tools/yulInterpreter/Interpreter.h>
+
+#include <memory>
+#include <vector>
+
+namespace solidity::yul::test
+{
+
+/**
+ * Executes Yul code in the same way as Interpreter, but first lowers the AST into a form in
+ * which variables are resolved to slots in the frame of their function, calls are resolved
+ * to builtins or functions and literal values are precomputed. Executing this form needs
+ * neither name lookups nor per-expression allocations.
+ *
+ * The resulting trace and state are identical to those of Interpreter, including the points
+ * at which the step, trace and expression nesting limits are reached.
+ * Only EVM and Wasm dialects are supported.
+ */
+class CompiledInterpreter
+{
+public:
+	/// Lowers @a _ast, which has to be valid and analysed code of @a _dialect.
+	CompiledInterpreter(Dialect const& _dialect, Block const& _ast);
+	~CompiledInterpreter();
+
+	/// Executes the code starting from @a _state.
+	void run(InterpreterState& _state) const;
+
+	static void run(InterpreterState& _state, Dialect const& _dialect, Block const& _ast)
+	{
+		CompiledInterpreter{_dialect, _ast}.run(_state);
+	}
+
+private:
+	struct CompiledExpression;
+	struct CompiledStatement;
+	struct CompiledBlock;
+	struct CompiledFunction;
+	class Compiler;
+	class Executor;
+
+	bool m_evm = false;
+	/// The top-level block, as the body of a function without parameters.
+	std::unique_ptr<CompiledFunction> m_main;
+	/// All functions defined in the code.
+	std::vector<std::unique_ptr<CompiledFunction>> m_functions;
+};
+
+}
@@ -19,13 +19,14 @@
  * Yul interpreter module that evaluates EVM instructions.
  */
 
-#include <test/tools/yulInterpreter/EVMInstructionInterpreter.h>
+#include <tools/yulInterpreter/EVMInstructionInterpreter.h>
 
-#include <test/tools/yulInterpreter/Interpreter.h>
+#include <tools/yulInterpreter/Interpreter.h>
 
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/AST.h>
 
+#include <libevmasm/GasMeter.h>
 #include <libevmasm/Instruction.h>
 
 #include <libsolutil/Keccak256.h>
@@ -41,6 +42,17 @@ using solidity::util::keccak256;
 namespace
 {
 
+/// Gas costs of accesses to warm and cold storage slots and accounts since Berlin (EIP-2929).
+unsigned const warmAccessGas = 100;
+unsigned const coldSloadGas = 2100;
+unsigned const coldAccountAccessGas = 2600;
+
+/// @returns the number of 32-byte words needed to hold @a _size bytes.
+bigint wordCount(u256 const& _size)
+{
+	return (bigint(_size) + 31) / 32;
+}
+
 /// Reads 32 bytes from @a _data at position @a _offset bytes while
 /// interpreting @a _data to be padded with an infinite number of zero
 /// bytes beyond its end.
@@ -68,12 +80,18 @@ u256 readZeroExtended(bytes const& _data, u256 const& _offset)
 /// @a _target at offset @a _targetOffset. Behaves as if @a _source would
 /// continue with an infinite sequence of zero bytes beyond its end.
 void copyZeroExtended(
-	map<u256, uint8_t>& _target, bytes const& _source,
+	InterpreterMemory& _target, bytes const& _source,
 	size_t _targetOffset, size_t _sourceOffset, size_t _size
 )
 {
-	for (size_t i = 0; i < _size; ++i)
-		_target[_targetOffset + i] = _sourceOffset + i < _source.size() ? _source[_sourceOffset + i] : 0;
+	bytes data(_size, 0);
+	if (_sourceOffset < _source.size())
+		copy_n(
+			_source.begin() + static_cast<ptrdiff_t>(_sourceOffset),
+			min(_size, _source.size() - _sourceOffset),
+			data.begin()
+		);
+	_target.write(_targetOffset, &data);
 }
 
 }
@@ -90,6 +108,7 @@ u256 EVMInstructionInterpreter::eval(
 
 	auto info = instructionInfo(_instruction);
 	yulAssert(static_cast<size_t>(info.args) == _arguments.size(), "");
+	meterGas(_instruction, _arguments);
 
 	auto const& arg = _arguments;
 	switch (_instruction)
@@ -267,7 +286,7 @@ u256 EVMInstructionInterpreter::eval(
 		return 0;
 	case Instruction::MSTORE8:
 		accessMemory(arg[0], 1);
-		m_state.memory[arg[0]] = uint8_t(arg[1] & 0xff);
+		m_state.memory.store(arg[0], uint8_t(arg[1] & 0xff));
 		return 0;
 	case Instruction::SLOAD:
 		return m_state.storage[h256(arg[0])];
@@ -432,6 +451,8 @@ u256 EVMInstructionInterpreter::evalBuiltin(
 	// Evaluate datasize/offset/copy instructions
 	if (fun == "datasize" || fun == "dataoffset")
 	{
+		// These are pushes of constants in the generated code.
+		meterGas(evmasm::Instruction::PUSH1, {});
 		string arg = std::get<Literal>(_arguments.at(0)).value.str();
 		if (arg.length() < 32)
 			arg.resize(32, 0);
@@ -448,6 +469,7 @@ u256 EVMInstructionInterpreter::evalBuiltin(
 	else if (fun == "datacopy")
 	{
 		// This is identical to codecopy.
+		meterGas(evmasm::Instruction::CODECOPY, _evaluatedArguments);
 		if (accessMemory(_evaluatedArguments.at(0), _evaluatedArguments.at(2)))
 			copyZeroExtended(
 				m_state.memory,
@@ -466,6 +488,7 @@ u256 EVMInstructionInterpreter::evalBuiltin(
 
 bool EVMInstructionInterpreter::accessMemory(u256 const& _offset, u256 const& _size)
 {
+	meterMemoryExpansion(_offset, _size);
 	if (((_offset + _size) >= _offset) && ((_offset + _size + 0x1f) >= (_offset + _size)))
 	{
 		u256 newSize = (_offset + _size + 0x1f) & ~u256(0x1f);
@@ -478,13 +501,162 @@ bool EVMInstructionInterpreter::accessMemory(u256 const& _offset, u256 const& _s
 	return false;
 }
 
+void EVMInstructionInterpreter::meterGas(evmasm::Instruction _instruction, vector<u256> const& _arguments)
+{
+	using namespace solidity::evmasm;
+	using evmasm::Instruction;
+
+	if (!m_state.gas)
+		return;
+
+	langutil::EVMVersion const evmVersion = m_state.gas->evmVersion;
+	auto const& arg = _arguments;
+	bigint gas;
+	switch (_instruction)
+	{
+	case Instruction::EXP:
+		gas = GasCosts::expGas;
+		if (arg[1] != 0)
+			gas += bigint(GasCosts::expByteGas(evmVersion)) * (boost::multiprecision::msb(arg[1]) / 8 + 1);
+		break;
+	case Instruction::KECCAK256:
+		gas = GasCosts::keccak256Gas + GasCosts::keccak256WordGas * wordCount(arg[1]);
+		break;
+	case Instruction::CALLDATACOPY:
+	case Instruction::CODECOPY:
+	case Instruction::RETURNDATACOPY:
+		gas = GasMeter::runGas(_instruction) + GasCosts::copyGas * wordCount(arg[2]);
+		break;
+	case Instruction::EXTCODECOPY:
+		gas = accountAccessGas(arg[0], GasCosts::extCodeGas(evmVersion)) + GasCosts::copyGas * wordCount(arg[3]);
+		break;
+	case Instruction::EXTCODESIZE:
+		gas = accountAccessGas(arg[0], GasCosts::extCodeGas(evmVersion));
+		break;
+	case Instruction::BALANCE:
+	case Instruction::EXTCODEHASH:
+		gas = accountAccessGas(arg[0], GasCosts::balanceGas(evmVersion));
+		break;
+	case Instruction::SLOAD:
+		gas = storageAccessGas(arg[0]);
+		break;
+	case Instruction::SSTORE:
+		gas = storageAccessGas(arg[0], arg[1]);
+		break;
+	case Instruction::LOG0:
+	case Instruction::LOG1:
+	case Instruction::LOG2:
+	case Instruction::LOG3:
+	case Instruction::LOG4:
+		gas =
+			GasCosts::logGas +
+			bigint(GasCosts::logTopicGas) * (arg.size() - 2) +
+			bigint(GasCosts::logDataGas) * arg[1];
+		break;
+	case Instruction::CREATE:
+		gas = GasCosts::createGas;
+		break;
+	case Instruction::CREATE2:
+		gas = GasCosts::createGas + GasCosts::keccak256WordGas * wordCount(arg[2]);
+		break;
+	case Instruction::CALL:
+	case Instruction::CALLCODE:
+		gas = accountAccessGas(arg[1], GasCosts::callGas(evmVersion));
+		if (arg[2] != 0)
+			gas += GasCosts::callValueTransferGas;
+		break;
+	case Instruction::DELEGATECALL:
+	case Instruction::STATICCALL:
+		gas = accountAccessGas(arg[1], GasCosts::callGas(evmVersion));
+		break;
+	case Instruction::SELFDESTRUCT:
+		gas = GasCosts::selfdestructGas(evmVersion);
+		if (accountAccessGas(arg[0], 0) == coldAccountAccessGas)
+			gas += coldAccountAccessGas;
+		break;
+	default:
+		gas = GasMeter::runGas(_instruction);
+		break;
+	}
+	chargeGas(gas);
+}
+
+void EVMInstructionInterpreter::meterMemoryExpansion(u256 const& _offset, u256 const& _size)
+{
+	if (!m_state.gas || _size == 0)
+		return;
+
+	auto memoryGas = [](bigint const& _words) {
+		return evmasm::GasCosts::memoryGas * _words + _words * _words / evmasm::GasCosts::quadCoeffDiv;
+	};
+	bigint words = (bigint(_offset) + _size + 31) / 32;
+	if (words > m_state.gas->memoryWords)
+	{
+		chargeGas(memoryGas(words) - memoryGas(m_state.gas->memoryWords));
+		m_state.gas->memoryWords = u256(words);
+	}
+}
+
+bigint EVMInstructionInterpreter::accountAccessGas(u256 const& _address, unsigned _gasBeforeBerlin)
+{
+	if (m_state.gas->evmVersion < langutil::EVMVersion::berlin())
+		return _gasBeforeBerlin;
+
+	u256 address = _address & ((u256(1) << 160) - 1);
+	bool warm =
+		(address >= 1 && address <= 9) ||
+		address == m_state.address ||
+		address == m_state.origin ||
+		!m_state.gas->accessedAccounts.insert(address).second;
+	return warm ? warmAccessGas : coldAccountAccessGas;
+}
+
+bigint EVMInstructionInterpreter::storageAccessGas(u256 const& _key, optional<u256> const& _newValue)
+{
+	using evmasm::GasCosts::sstoreResetGas;
+	using evmasm::GasCosts::sstoreSetGas;
+
+	langutil::EVMVersion const evmVersion = m_state.gas->evmVersion;
+	h256 const key(_key);
+	h256 current;
+	if (auto it = m_state.storage.find(key); it != m_state.storage.end())
+		current = it->second;
+	auto [original, cold] = m_state.gas->originalStorage.emplace(key, current);
+
+	if (evmVersion < langutil::EVMVersion::istanbul())
+	{
+		if (!_newValue)
+			return evmasm::GasCosts::sloadGas(evmVersion);
+		else
+			return current == h256{} && *_newValue != 0 ? sstoreSetGas : sstoreResetGas;
+	}
+
+	// Net gas metering of EIP-2200, with the changes of EIP-2929 since Berlin.
+	bool const berlin = evmVersion >= langutil::EVMVersion::berlin();
+	bigint coldGas = berlin && cold ? coldSloadGas : 0;
+	if (!_newValue)
+		return berlin ? (cold ? coldSloadGas : warmAccessGas) : evmasm::GasCosts::sloadGas(evmVersion);
+	else if (current == h256(*_newValue) || original->second != current)
+		return coldGas + (berlin ? warmAccessGas : evmasm::GasCosts::sloadGas(evmVersion));
+	else if (original->second == h256{})
+		return coldGas + sstoreSetGas;
+	else
+		return coldGas + sstoreResetGas - (berlin ? coldSloadGas : 0);
+}
+
+void EVMInstructionInterpreter::chargeGas(bigint const& _amount)
+{
+	auto add = [&](u256& _total) {
+		_total = u256(min(bigint(_total) + _amount, bigint(u256(-1))));
+	};
+	add(m_state.gas->used);
+	add(m_state.gas->usedByFunction[m_state.currentFunction]);
+}
+
 bytes EVMInstructionInterpreter::readMemory(u256 const& _offset, u256 const& _size)
 {
 	yulAssert(_size <= 0xffff, "Too large read.");
-	bytes data(size_t(_size), uint8_t(0));
-	for (size_t i = 0; i < data.size(); ++i)
-		data[i] = m_state.memory[_offset + i];
-	return data;
+	return m_state.memory.read(_offset, size_t(_size));
 }
 
 u256 EVMInstructionInterpreter::readMemoryWord(u256 const& _offset)
@@ -494,8 +666,8 @@ u256 EVMInstructionInterpreter::readMemoryWord(u256 const& _offset)
 
 void EVMInstructionInterpreter::writeMemoryWord(u256 const& _offset, u256 const& _value)
 {
-	for (size_t i = 0; i < 32; i++)
-		m_state.memory[_offset + i] = uint8_t((_value >> (8 * (31 - i))) & 0xff);
+	h256 word(_value);
+	m_state.memory.write(_offset, word.ref());
 }
 
 
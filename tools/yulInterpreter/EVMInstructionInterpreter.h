@@ -25,6 +25,7 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <optional>
 #include <vector>
 
 namespace solidity::evmasm
@@ -48,8 +49,8 @@ struct InterpreterState;
  * side-effects.
  *
  * Since this is mainly meant to be used for differential fuzz testing, it is focused
- * on a single contract only, does not do any gas counting and differs from the correct
- * implementation in many ways:
+ * on a single contract only, only counts gas if requested in the state and differs from the
+ * correct implementation in many ways:
  *
  * - If memory access to a "large" memory position is performed, a deterministic
  *   value is returned. Data that is stored in a "large" memory position is not
@@ -82,6 +83,17 @@ private:
 	/// msize accordingly.
 	/// @returns false if the amount of bytes read is lager than 0xffff
 	bool accessMemory(u256 const& _offset, u256 const& _size = 32);
+	/// Charges the gas for @a _instruction, except for memory expansion, if gas is metered.
+	void meterGas(evmasm::Instruction _instruction, std::vector<u256> const& _arguments);
+	/// Charges the gas for expanding memory to cover the given range, if gas is metered.
+	void meterMemoryExpansion(u256 const& _offset, u256 const& _size);
+	/// @returns the gas for accessing the account at @a _address, marking it as warm.
+	bigint accountAccessGas(u256 const& _address, unsigned _gasBeforeBerlin);
+	/// @returns the gas for loading or, if @a _newValue is given, storing the storage slot
+	/// @a _key, marking it as warm.
+	bigint storageAccessGas(u256 const& _key, std::optional<u256> const& _newValue = std::nullopt);
+	/// Adds @a _amount to the gas used in total and by the current function.
+	void chargeGas(bigint const& _amount);
 	/// @returns the memory contents at the provided address.
 	/// Does not adjust msize, use @a accessMemory for that
 	bytes readMemory(u256 const& _offset, u256 const& _size = 32);
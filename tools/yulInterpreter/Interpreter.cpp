@@ -19,10 +19,10 @@
  * Yul interpreter.
  */
 
-#include <test/tools/yulInterpreter/Interpreter.h>
+#include <tools/yulInterpreter/Interpreter.h>
 
-#include <test/tools/yulInterpreter/EVMInstructionInterpreter.h>
-#include <test/tools/yulInterpreter/EwasmBuiltinInterpreter.h>
+#include <tools/yulInterpreter/EVMInstructionInterpreter.h>
+#include <tools/yulInterpreter/EwasmBuiltinInterpreter.h>
 
 #include <libyul/AST.h>
 #include <libyul/Dialect.h>
@@ -35,6 +35,7 @@
 #include <libsolutil/FixedHash.h>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <range/v3/view/reverse.hpp>
 
@@ -48,11 +49,95 @@ using namespace solidity::yul::test;
 
 using solidity::util::h256;
 
+uint8_t InterpreterMemory::load(u256 const& _address) const
+{
+	if (Page const* page = findPage(_address >> pageBits))
+		return (*page)[static_cast<size_t>(_address & (pageSize - 1))];
+	return 0;
+}
+
+void InterpreterMemory::store(u256 const& _address, uint8_t _value)
+{
+	page(_address >> pageBits)[static_cast<size_t>(_address & (pageSize - 1))] = _value;
+}
+
+bytes InterpreterMemory::read(u256 const& _offset, size_t _size) const
+{
+	bytes data(_size, 0);
+	u256 address = _offset;
+	for (size_t position = 0; position < _size;)
+	{
+		size_t const pageOffset = static_cast<size_t>(address & (pageSize - 1));
+		size_t const chunkSize = min(_size - position, pageSize - pageOffset);
+		if (Page const* page = findPage(address >> pageBits))
+			copy_n(page->data() + pageOffset, chunkSize, data.data() + position);
+		position += chunkSize;
+		address += chunkSize;
+	}
+	return data;
+}
+
+void InterpreterMemory::write(u256 const& _offset, bytesConstRef _data)
+{
+	u256 address = _offset;
+	for (size_t position = 0; position < _data.size();)
+	{
+		size_t const pageOffset = static_cast<size_t>(address & (pageSize - 1));
+		size_t const chunkSize = min(_data.size() - position, pageSize - pageOffset);
+		copy_n(_data.data() + position, chunkSize, page(address >> pageBits).data() + pageOffset);
+		position += chunkSize;
+		address += chunkSize;
+	}
+}
+
+map<u256, u256> InterpreterMemory::nonZeroWords() const
+{
+	map<u256, u256> words;
+	for (auto const& [pageIndex, page]: m_pages)
+		for (size_t offset = 0; offset < pageSize; offset += 0x20)
+		{
+			bytesConstRef word(page.data() + offset, 0x20);
+			if (any_of(word.begin(), word.end(), [](uint8_t _byte) { return _byte != 0; }))
+				words[(pageIndex << pageBits) + offset] = u256(h256(word));
+		}
+	return words;
+}
+
+size_t InterpreterMemory::PageIndexHash::operator()(u256 const& _pageIndex) const
+{
+	size_t seed = 0;
+	for (u256 index = _pageIndex; index != 0; index >>= 64)
+		boost::hash_combine(seed, static_cast<uint64_t>(index & numeric_limits<uint64_t>::max()));
+	return seed;
+}
+
+InterpreterMemory::Page const* InterpreterMemory::findPage(u256 const& _pageIndex) const
+{
+	auto it = m_pages.find(_pageIndex);
+	return it == m_pages.end() ? nullptr : &it->second;
+}
+
+InterpreterMemory::Page& InterpreterMemory::page(u256 const& _pageIndex)
+{
+	auto [it, inserted] = m_pages.try_emplace(_pageIndex);
+	if (inserted)
+		it->second.fill(0);
+	return it->second;
+}
+
+size_t StorageKeyHash::operator()(h256 const& _key) const
+{
+	return boost::hash_range(_key.data(), _key.data() + h256::size);
+}
+
 void InterpreterState::dumpStorage(ostream& _out) const
 {
-	for (auto const& slot: storage)
-		if (slot.second != h256{})
-			_out << "  " << slot.first.hex() << ": " << slot.second.hex() << endl;
+	map<h256, h256> nonZeroSlots;
+	for (auto const& [key, value]: storage)
+		if (value != h256{})
+			nonZeroSlots[key] = value;
+	for (auto const& [key, value]: nonZeroSlots)
+		_out << "  " << key.hex() << ": " << value.hex() << endl;
 }
 
 void InterpreterState::dumpTraceAndState(ostream& _out) const
@@ -61,14 +146,23 @@ void InterpreterState::dumpTraceAndState(ostream& _out) const
 	for (auto const& line: trace)
 		_out << "  " << line << endl;
 	_out << "Memory dump:\n";
-	map<u256, u256> words;
-	for (auto const& [offset, value]: memory)
-		words[(offset / 0x20) * 0x20] |= u256(uint32_t(value)) << (256 - 8 - 8 * static_cast<size_t>(offset % 0x20));
-	for (auto const& [offset, value]: words)
-		if (value != 0)
-			_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << endl;
+	for (auto const& [offset, value]: memory.nonZeroWords())
+		_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << endl;
 	_out << "Storage dump:" << endl;
 	dumpStorage(_out);
+	if (gas)
+		dumpGas(_out);
+}
+
+void InterpreterState::dumpGas(ostream& _out) const
+{
+	yulAssert(gas, "");
+	map<string, u256> usedByFunction;
+	for (auto const& [function, used]: gas->usedByFunction)
+		usedByFunction[function.empty() ? "<top-level>" : function.str()] = used;
+	_out << "Gas used: " << std::dec << gas->used << endl;
+	for (auto const& [function, used]: usedByFunction)
+		_out << "  " << function << ": " << used << endl;
 }
 
 void Interpreter::run(InterpreterState& _state, Dialect const& _dialect, Block const& _ast)
@@ -307,10 +401,13 @@ void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 	for (size_t i = 0; i < fun->returnVariables.size(); ++i)
 		variables[fun->returnVariables.at(i).name] = 0;
 
+	YulString outerFunction = m_state.currentFunction;
+	m_state.currentFunction = fun->name;
 	m_state.controlFlowState = ControlFlowState::Default;
 	Interpreter interpreter(m_state, m_dialect, *scope, std::move(variables));
 	interpreter(fun->body);
 	m_state.controlFlowState = ControlFlowState::Default;
+	m_state.currentFunction = outerFunction;
 
 	m_values.clear();
 	for (auto const& retVar: fun->returnVariables)
@@ -24,12 +24,18 @@
 #include <libyul/ASTForward.h>
 #include <libyul/optimiser/ASTWalker.h>
 
+#include <liblangutil/EVMVersion.h>
+
 #include <libsolutil/FixedHash.h>
 #include <libsolutil/CommonData.h>
 
 #include <libsolutil/Exceptions.h>
 
+#include <array>
 #include <map>
+#include <optional>
+#include <set>
+#include <unordered_map>
 
 namespace solidity::yul
 {
@@ -67,14 +73,80 @@ enum class ControlFlowState
 	Leave
 };
 
+/**
+ * Byte-addressable memory covering the whole u256 address range. It is divided into pages of
+ * fixed size that are only allocated when they are first written to, so that both accesses
+ * at small and at very large offsets are cheap. Bytes that were never written read as zero.
+ */
+class InterpreterMemory
+{
+public:
+	uint8_t load(u256 const& _address) const;
+	void store(u256 const& _address, uint8_t _value);
+	/// Reads @a _size bytes starting at @a _offset. Addresses wrap around at 2**256.
+	bytes read(u256 const& _offset, size_t _size) const;
+	/// Writes @a _data starting at @a _offset. Addresses wrap around at 2**256.
+	void write(u256 const& _offset, bytesConstRef _data);
+	/// @returns the non-zero 32-byte words of the memory, indexed by their offset.
+	std::map<u256, u256> nonZeroWords() const;
+
+private:
+	static constexpr unsigned pageBits = 12;
+	static constexpr size_t pageSize = size_t(1) << pageBits;
+	using Page = std::array<uint8_t, pageSize>;
+
+	struct PageIndexHash
+	{
+		size_t operator()(u256 const& _pageIndex) const;
+	};
+
+	/// @returns the page with the given index or nullptr if it was never written to.
+	Page const* findPage(u256 const& _pageIndex) const;
+	/// @returns the page with the given index, allocating it if necessary.
+	Page& page(u256 const& _pageIndex);
+
+	std::unordered_map<u256, Page, PageIndexHash> m_pages;
+};
+
+struct StorageKeyHash
+{
+	size_t operator()(util::h256 const& _key) const;
+};
+
+/**
+ * Gas accounting of the interpreter for a given EVM version. Only the costs of builtins are
+ * metered, including memory expansion and the rules for warm and cold storage and account
+ * accesses, but not the costs of stack manipulation, jumps and function calls, which depend
+ * on the code generator. Gas passed on to calls and refunds are ignored.
+ */
+struct InterpreterGas
+{
+	explicit InterpreterGas(langutil::EVMVersion _evmVersion): evmVersion(_evmVersion) {}
+
+	langutil::EVMVersion evmVersion;
+	/// Total amount of gas used, saturating at 2**256 - 1.
+	u256 used = 0;
+	/// Gas used by the builtins called directly in the body of each function, by the name
+	/// of the function. Code outside of functions is attributed to the empty name.
+	std::map<YulString, u256> usedByFunction;
+	/// Number of 32-byte words of memory that have been paid for.
+	u256 memoryWords = 0;
+	/// Values of the accessed storage slots before their first access. Slots contained in
+	/// this map are warm.
+	std::unordered_map<util::h256, util::h256, StorageKeyHash> originalStorage;
+	/// Accessed accounts other than the precompiles, the origin and the executing account,
+	/// which are always warm.
+	std::set<u256> accessedAccounts;
+};
+
 struct InterpreterState
 {
 	bytes calldata;
 	bytes returndata;
-	std::map<u256, uint8_t> memory;
+	InterpreterMemory memory;
 	/// This is different than memory.size() because we ignore gas.
 	u256 msize;
-	std::map<util::h256, util::h256> storage;
+	std::unordered_map<util::h256, util::h256, StorageKeyHash> storage;
 	u160 address = 0x11111111;
 	u256 balance = 0x22222222;
 	u256 selfbalance = 0x22223333;
@@ -98,11 +170,17 @@ struct InterpreterState
 	size_t numSteps = 0;
 	size_t maxExprNesting = 0;
 	ControlFlowState controlFlowState = ControlFlowState::Default;
+	/// Name of the function whose body is being executed, empty outside of functions.
+	YulString currentFunction;
+	/// If set, gas is metered according to its rules and reported in the dump.
+	std::optional<InterpreterGas> gas;
 
 	/// Prints execution trace and non-zero storage to @param _out.
 	void dumpTraceAndState(std::ostream& _out) const;
-	/// Prints non-zero storage to @param _out.
+	/// Prints non-zero storage to @param _out, ordered by key.
 	void dumpStorage(std::ostream& _out) const;
+	/// Prints the gas used in total and by each function to @param _out.
+	void dumpGas(std::ostream& _out) const;
 };
 
 /**
@@ -18,15 +18,171 @@
 
 #include <tools/yulPhaser/FitnessMetrics.h>
 
+#include <tools/yulInterpreter/CompiledInterpreter.h>
+#include <tools/yulInterpreter/Interpreter.h>
+
+#include <libyul/AST.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/optimiser/ASTWalker.h>
+
+#include <libevmasm/Instruction.h>
+
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/Parallel.h>
 
 #include <cmath>
+#include <initializer_list>
+#include <limits>
 
 using namespace std;
+using namespace solidity;
+using namespace solidity::evmasm;
 using namespace solidity::util;
 using namespace solidity::yul;
+using namespace solidity::yul::test;
 using namespace solidity::phaser;
 
+namespace
+{
+
+/**
+ * Estimates the gas needed to store the code of a program when it is deployed, based on the
+ * instructions that the code generator emits for it. The deployment costs of the individual
+ * instructions, literals and identifiers come from @a GasMeterVisitor.
+ */
+class DeploymentGasEstimator: public ASTWalker
+{
+public:
+	explicit DeploymentGasEstimator(EVMDialect const& _dialect): m_dialect(_dialect) {}
+
+	static bigint gasCost(Block const& _ast, EVMDialect const& _dialect)
+	{
+		DeploymentGasEstimator estimator(_dialect);
+		estimator(_ast);
+		return estimator.m_dataGas;
+	}
+
+	using ASTWalker::operator();
+
+	void operator()(FunctionCall const& _functionCall) override
+	{
+		ASTWalker::operator()(_functionCall);
+		if (BuiltinFunctionForEVM const* builtin = m_dialect.builtin(_functionCall.functionName.name))
+			// Builtins without an instruction, like datasize(), compile down to a constant.
+			addInstructions({builtin->instruction.value_or(Instruction::PUSH1)});
+		else
+			// Push the return label and the function label, jump there and back.
+			addInstructions({Instruction::PUSH1, Instruction::PUSH1, Instruction::JUMP, Instruction::JUMPDEST});
+	}
+	void operator()(Literal const& _literal) override { addCosts(Expression{_literal}); }
+	void operator()(Identifier const& _identifier) override { addCosts(Expression{_identifier}); }
+
+	void operator()(Assignment const& _assignment) override
+	{
+		visit(*_assignment.value);
+		for (size_t i = 0; i < _assignment.variableNames.size(); ++i)
+			addInstructions({Instruction::SWAP1, Instruction::POP});
+	}
+	void operator()(VariableDeclaration const& _variableDeclaration) override
+	{
+		ASTWalker::operator()(_variableDeclaration);
+		if (!_variableDeclaration.value)
+			for (size_t i = 0; i < _variableDeclaration.variables.size(); ++i)
+				addInstructions({Instruction::PUSH1});
+	}
+	void operator()(If const& _if) override
+	{
+		ASTWalker::operator()(_if);
+		addInstructions({Instruction::ISZERO, Instruction::PUSH1, Instruction::JUMPI, Instruction::JUMPDEST});
+	}
+	void operator()(Switch const& _switch) override
+	{
+		ASTWalker::operator()(_switch);
+		for (auto const& switchCase: _switch.cases)
+			if (switchCase.value)
+				addInstructions({Instruction::DUP1, Instruction::EQ, Instruction::PUSH1, Instruction::JUMPI, Instruction::JUMPDEST});
+		addInstructions({Instruction::JUMPDEST, Instruction::POP});
+	}
+	void operator()(ForLoop const& _forLoop) override
+	{
+		ASTWalker::operator()(_forLoop);
+		addInstructions({
+			Instruction::JUMPDEST,
+			Instruction::ISZERO,
+			Instruction::PUSH1,
+			Instruction::JUMPI,
+			Instruction::PUSH1,
+			Instruction::JUMP,
+			Instruction::JUMPDEST,
+		});
+	}
+	void operator()(Break const&) override { addInstructions({Instruction::PUSH1, Instruction::JUMP}); }
+	void operator()(Continue const&) override { addInstructions({Instruction::PUSH1, Instruction::JUMP}); }
+	void operator()(Leave const&) override { addInstructions({Instruction::PUSH1, Instruction::JUMP}); }
+	void operator()(FunctionDefinition const& _functionDefinition) override
+	{
+		ASTWalker::operator()(_functionDefinition);
+		addInstructions({Instruction::JUMPDEST, Instruction::JUMP});
+	}
+
+private:
+	void addCosts(Expression const& _expression)
+	{
+		m_dataGas += GasMeterVisitor::costs(_expression, m_dialect, false /* _isCreation */).second;
+	}
+	void addInstructions(initializer_list<Instruction> _instructions)
+	{
+		for (Instruction instruction: _instructions)
+			m_dataGas += GasMeterVisitor::instructionCosts(instruction, m_dialect).second;
+	}
+
+	EVMDialect const& m_dialect;
+	bigint m_dataGas = 0;
+};
+
+/// @returns the gas used by executing the program in the interpreter with the given calldata.
+u256 executionGasCost(CompiledInterpreter const& _interpreter, EVMDialect const& _dialect, bytes const& _calldata)
+{
+	InterpreterState state;
+	state.calldata = _calldata;
+	state.callvalue = 0;
+	state.maxSteps = ProgramGasCost::MaxSteps;
+	state.gas.emplace(_dialect.evmVersion());
+	try
+	{
+		_interpreter.run(state);
+	}
+	catch (InterpreterTerminatedGeneric const&)
+	{
+		// Covers both the regular end of the execution through stop(), return() or revert()
+		// and reaching the step limit.
+	}
+
+	return state.gas->used;
+}
+
+}
+
+vector<size_t> FitnessMetric::evaluateAll(vector<Chromosome> const& _chromosomes)
+{
+	vector<size_t> values;
+	for (auto const& chromosome: _chromosomes)
+		values.push_back(evaluate(chromosome));
+
+	return values;
+}
+
+vector<size_t> ParallelFitnessMetric::evaluateAll(vector<Chromosome> const& _chromosomes)
+{
+	vector<size_t> values(_chromosomes.size());
+	parallelFor(_chromosomes.size(), m_threadCount, [&](size_t _index) {
+		values[_index] = m_metric->evaluate(_chromosomes[_index]);
+	});
+
+	return values;
+}
+
 Program const& ProgramBasedMetric::program() const
 {
 	if (m_programCache == nullptr)
@@ -75,6 +231,24 @@ size_t RelativeProgramSize::evaluate(Chromosome const& _chromosome)
 	));
 }
 
+size_t ProgramGasCost::evaluate(Chromosome const& _chromosome)
+{
+	Program program = optimisedProgram(_chromosome);
+
+	auto const* dialect = dynamic_cast<EVMDialect const*>(&program.dialect());
+	assert(dialect && "Gas costs can only be measured for EVM programs.");
+
+	CompiledInterpreter interpreter(*dialect, program.ast());
+	bigint executionCost = 0;
+	for (bytes const& calldata: m_calldata)
+		executionCost += executionGasCost(interpreter, *dialect, calldata);
+
+	bigint cost =
+		executionCost * m_expectedExecutionsPerDeployment +
+		DeploymentGasEstimator::gasCost(program.ast(), *dialect);
+	return static_cast<size_t>(min(cost, bigint(numeric_limits<size_t>::max())));
+}
+
 size_t FitnessMetricAverage::evaluate(Chromosome const& _chromosome)
 {
 	assert(m_metrics.size() > 0);
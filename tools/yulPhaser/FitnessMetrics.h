@@ -27,8 +27,12 @@
 
 #include <libyul/optimiser/Metrics.h>
 
+#include <libsolutil/CommonData.h>
+
 #include <cstddef>
+#include <memory>
 #include <optional>
+#include <vector>
 
 namespace solidity::phaser
 {
@@ -49,6 +53,40 @@ public:
 	virtual ~FitnessMetric() = default;
 
 	virtual size_t evaluate(Chromosome const& _chromosome) = 0;
+
+	/// Evaluates all the chromosomes and returns the values in the same order. Evaluates them
+	/// one by one unless a derived class has a better strategy.
+	virtual std::vector<size_t> evaluateAll(std::vector<Chromosome> const& _chromosomes);
+};
+
+/**
+ * Fitness metric that delegates evaluation to a nested metric but evaluates multiple chromosomes
+ * concurrently, using up to the specified number of threads.
+ *
+ * The values do not depend on the number of threads or on the order in which the chromosomes are
+ * processed as long as the nested metric is deterministic and safe to use from multiple threads
+ * at the same time.
+ */
+class ParallelFitnessMetric: public FitnessMetric
+{
+public:
+	explicit ParallelFitnessMetric(std::shared_ptr<FitnessMetric> _metric, size_t _threadCount):
+		m_metric(std::move(_metric)),
+		m_threadCount(_threadCount)
+	{
+		assert(m_metric != nullptr);
+		assert(m_threadCount > 0);
+	}
+
+	std::shared_ptr<FitnessMetric> const& metric() const { return m_metric; }
+	size_t threadCount() const { return m_threadCount; }
+
+	size_t evaluate(Chromosome const& _chromosome) override { return m_metric->evaluate(_chromosome); }
+	std::vector<size_t> evaluateAll(std::vector<Chromosome> const& _chromosomes) override;
+
+private:
+	std::shared_ptr<FitnessMetric> m_metric;
+	size_t m_threadCount;
 };
 
 /**
@@ -132,6 +170,46 @@ private:
 	size_t m_fixedPointPrecision;
 };
 
+/**
+ * Fitness metric based on the gas needed to deploy the program after applying the optimisations
+ * from the chromosome to it and to execute it @a _expectedExecutionsPerDeployment times for each of
+ * the given calldata scenarios. The costs are combined the same way the optimiser's @a GasMeter
+ * does it for @a OptimiserSettings::expectedExecutionsPerDeployment.
+ *
+ * The execution cost is measured by running the program in the Yul interpreter with gas metering
+ * enabled, so it accounts for loops, branches and the state of memory and storage. The interpreter
+ * only charges builtins, not the stack manipulation and jumps that the code generator adds. An
+ * execution that exceeds the step limit of the interpreter is charged the gas used until then.
+ * The deployment cost is a static estimate of the cost of storing the code.
+ */
+class ProgramGasCost: public ProgramBasedMetric
+{
+public:
+	/// Maximum number of statements and expressions the interpreter evaluates in one execution.
+	static constexpr size_t MaxSteps = 1000000;
+
+	explicit ProgramGasCost(
+		std::optional<Program> _program,
+		std::shared_ptr<ProgramCache> _programCache,
+		std::vector<bytes> _calldata,
+		size_t _expectedExecutionsPerDeployment,
+		yul::CodeWeights const& _weights,
+		size_t _repetitionCount = 1
+	):
+		ProgramBasedMetric(std::move(_program), std::move(_programCache), _weights, _repetitionCount),
+		m_calldata(std::move(_calldata)),
+		m_expectedExecutionsPerDeployment(_expectedExecutionsPerDeployment) {}
+
+	std::vector<bytes> const& calldata() const { return m_calldata; }
+	size_t expectedExecutionsPerDeployment() const { return m_expectedExecutionsPerDeployment; }
+
+	size_t evaluate(Chromosome const& _chromosome) override;
+
+private:
+	std::vector<bytes> m_calldata;
+	size_t m_expectedExecutionsPerDeployment;
+};
+
 /**
  * Abstract base class for fitness metrics that compute their value based on values of multiple
  * other, nested metrics.
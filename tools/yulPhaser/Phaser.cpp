@@ -31,6 +31,7 @@
 #include <libsolutil/Assertions.h>
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/Parallel.h>
 
 #include <boost/filesystem.hpp>
 
@@ -68,6 +69,7 @@ map<MetricChoice, string> MetricChoiceToStringMap =
 {
 	{MetricChoice::CodeSize, "code-size"},
 	{MetricChoice::RelativeCodeSize, "relative-code-size"},
+	{MetricChoice::GasCost, "gas-cost"},
 };
 map<string, MetricChoice> const StringToMetricChoiceMap = invertMap(MetricChoiceToStringMap);
 
@@ -88,6 +90,22 @@ map<CrossoverChoice, string> const CrossoverChoiceToStringMap =
 };
 map<string, CrossoverChoice> const StringToCrossoverChoiceMap = invertMap(CrossoverChoiceToStringMap);
 
+vector<bytes> parseCalldata(vector<string> const& _hexCalldata)
+{
+	vector<bytes> calldata;
+	for (string const& hex: _hexCalldata)
+	{
+		string digits = hex.substr(0, 2) == "0x" ? hex.substr(2) : hex;
+		assertThrow(
+			digits.find_first_not_of("0123456789abcdefABCDEF") == string::npos,
+			BadInput,
+			"Invalid hex-encoded calldata: " + hex
+		);
+		calldata.push_back(fromHex(digits));
+	}
+	return calldata;
+}
+
 }
 
 istream& phaser::operator>>(istream& _inputStream, PhaserMode& _phaserMode) { return deserializeChoice(_inputStream, _phaserMode, StringToPhaserModeMap); }
@@ -218,6 +236,15 @@ FitnessMetricFactory::Options FitnessMetricFactory::Options::fromCommandLine(po:
 		_arguments["metric-aggregator"].as<MetricAggregatorChoice>(),
 		_arguments["relative-metric-scale"].as<size_t>(),
 		_arguments["chromosome-repetitions"].as<size_t>(),
+		_arguments["expected-executions-per-deployment"].as<size_t>(),
+		parseCalldata(
+			_arguments.count("calldata") > 0 ?
+				_arguments["calldata"].as<vector<string>>() :
+				vector<string>{""}
+		),
+		_arguments["threads"].as<size_t>() > 0 ?
+			_arguments["threads"].as<size_t>() :
+			defaultThreadCount(),
 	};
 }
 
@@ -258,23 +285,46 @@ unique_ptr<FitnessMetric> FitnessMetricFactory::build(
 				));
 			break;
 		}
+		case MetricChoice::GasCost:
+		{
+			for (size_t i = 0; i < _programs.size(); ++i)
+				metrics.push_back(make_unique<ProgramGasCost>(
+					_programCaches[i] != nullptr ? optional<Program>{} : move(_programs[i]),
+					move(_programCaches[i]),
+					_options.calldata,
+					_options.expectedExecutionsPerDeployment,
+					_weights,
+					_options.chromosomeRepetitions
+				));
+			break;
+		}
 		default:
 			assertThrow(false, solidity::util::Exception, "Invalid MetricChoice value.");
 	}
 
+	unique_ptr<FitnessMetric> metric;
 	switch (_options.metricAggregator)
 	{
 		case MetricAggregatorChoice::Average:
-			return make_unique<FitnessMetricAverage>(move(metrics));
+			metric = make_unique<FitnessMetricAverage>(move(metrics));
+			break;
 		case MetricAggregatorChoice::Sum:
-			return make_unique<FitnessMetricSum>(move(metrics));
+			metric = make_unique<FitnessMetricSum>(move(metrics));
+			break;
 		case MetricAggregatorChoice::Maximum:
-			return make_unique<FitnessMetricMaximum>(move(metrics));
+			metric = make_unique<FitnessMetricMaximum>(move(metrics));
+			break;
 		case MetricAggregatorChoice::Minimum:
-			return make_unique<FitnessMetricMinimum>(move(metrics));
+			metric = make_unique<FitnessMetricMinimum>(move(metrics));
+			break;
 		default:
 			assertThrow(false, solidity::util::Exception, "Invalid MetricAggregatorChoice value.");
 	}
+
+	if (_options.threadCount > 1)
+		return make_unique<ParallelFitnessMetric>(move(metric), _options.threadCount);
+
+	return metric;
 }
 
 PopulationFactory::Options PopulationFactory::Options::fromCommandLine(po::variables_map const& _arguments)
@@ -357,6 +407,9 @@ ProgramCacheFactory::Options ProgramCacheFactory::Options::fromCommandLine(po::v
 {
 	return {
 		_arguments["program-cache"].as<bool>(),
+		_arguments.count("program-cache-max-size") > 0 ?
+			_arguments["program-cache-max-size"].as<size_t>() :
+			optional<size_t>{},
 	};
 }
 
@@ -365,9 +418,18 @@ vector<shared_ptr<ProgramCache>> ProgramCacheFactory::build(
 	vector<Program> _programs
 )
 {
+	// The limit applies to all the caches together. Each program gets an equal share.
+	optional<size_t> maxTotalCodeSizePerProgram;
+	if (_options.maxTotalCodeSize.has_value() && !_programs.empty())
+		maxTotalCodeSizePerProgram = _options.maxTotalCodeSize.value() / _programs.size();
+
 	vector<shared_ptr<ProgramCache>> programCaches;
 	for (Program& program: _programs)
-		programCaches.push_back(_options.programCacheEnabled ? make_shared<ProgramCache>(move(program)) : nullptr);
+		programCaches.push_back(
+			_options.programCacheEnabled ?
+			make_shared<ProgramCache>(move(program), maxTotalCodeSizePerProgram) :
+			nullptr
+		);
 
 	return programCaches;
 }
@@ -455,6 +517,13 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			"or removed using this option. The value given here is applied after it."
 		)
 		("seed", po::value<uint32_t>()->value_name("<NUM>"), "Seed for the random number generator.")
+		(
+			"threads",
+			po::value<size_t>()->value_name("<NUM>")->default_value(1),
+			"Number of threads used to evaluate the fitness of chromosomes. "
+			"0 means one thread per available CPU core.\n"
+			"The results for a given seed do not depend on this value."
+		)
 		(
 			"rounds",
 			po::value<size_t>()->value_name("<NUM>"),
@@ -642,7 +711,8 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 				"\n"
 				"AVAILABLE METRICS:\n"
 				"* " + toString(MetricChoice::CodeSize) + "\n" +
-				"* " + toString(MetricChoice::RelativeCodeSize)
+				"* " + toString(MetricChoice::RelativeCodeSize) + "\n" +
+				"* " + toString(MetricChoice::GasCost)
 			).c_str()
 		)
 		(
@@ -676,6 +746,26 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			po::value<size_t>()->value_name("<COUNT>")->default_value(1),
 			"Number of times to repeat the sequence optimisation steps represented by a chromosome."
 		)
+		(
+			"expected-executions-per-deployment",
+			po::value<size_t>()->value_name("<RUNS>")->default_value(200),
+			(
+				"Used only by the " + toString(MetricChoice::GasCost) + " metric. "
+				"Specifies how many times the code is expected to be executed per deployment, "
+				"i.e. how much the execution cost matters compared to the deployment cost. "
+				"Has the same meaning as the --optimize-runs option of the compiler."
+			).c_str()
+		)
+		(
+			"calldata",
+			po::value<vector<string>>()->multitoken()->value_name("<HEX>"),
+			(
+				"Used only by the " + toString(MetricChoice::GasCost) + " metric. "
+				"Hex-encoded calldata to execute the program with. "
+				"The execution costs of all given calldata are added up. "
+				"If not specified, the program is executed once with empty calldata."
+			).c_str()
+		)
 	;
 	keywordDescription.add(metricsDescription);
 
@@ -708,9 +798,16 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			po::bool_switch(),
 			"Enables caching of intermediate programs corresponding to chromosome prefixes.\n"
 			"This speeds up fitness evaluation by a lot but eats tons of memory if the chromosomes are long. "
-			"Disabled by default since there's currently no way to set an upper limit on memory usage but "
+			"Disabled by default since memory usage is unlimited unless --program-cache-max-size is given but "
 			"highly recommended if your computer has enough RAM."
 		)
+		(
+			"program-cache-max-size",
+			po::value<size_t>()->value_name("<SIZE>"),
+			"Upper limit on the total size of programs stored in the cache, split evenly between input programs. "
+			"The size is measured in AST nodes, the same way as the size of cached code shown by --show-cache-stats. "
+			"When the limit is exceeded, the least recently used programs are evicted. (default=no limit)"
+		)
 	;
 	keywordDescription.add(cacheDescription);
 
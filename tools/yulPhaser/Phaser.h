@@ -74,6 +74,7 @@ enum class MetricChoice
 {
 	CodeSize,
 	RelativeCodeSize,
+	GasCost,
 };
 
 enum class MetricAggregatorChoice
@@ -156,6 +157,9 @@ public:
 		MetricAggregatorChoice metricAggregator;
 		size_t relativeMetricScale;
 		size_t chromosomeRepetitions;
+		size_t expectedExecutionsPerDeployment;
+		std::vector<bytes> calldata;
+		size_t threadCount;
 
 		static Options fromCommandLine(boost::program_options::variables_map const& _arguments);
 	};
@@ -214,6 +218,7 @@ public:
 	struct Options
 	{
 		bool programCacheEnabled;
+		std::optional<size_t> maxTotalCodeSize;
 
 		static Options fromCommandLine(boost::program_options::variables_map const& _arguments);
 	};
@@ -31,6 +31,7 @@ CacheStats& CacheStats::operator+=(CacheStats const& _other)
 	hits += _other.hits;
 	misses += _other.misses;
 	totalCodeSize += _other.totalCodeSize;
+	evictions += _other.evictions;
 
 	for (auto& [round, count]: _other.roundEntryCounts)
 		if (roundEntryCounts.find(round) != roundEntryCounts.end())
@@ -47,7 +48,8 @@ bool CacheStats::operator==(CacheStats const& _other) const
 		hits == _other.hits &&
 		misses == _other.misses &&
 		totalCodeSize == _other.totalCodeSize &&
-		roundEntryCounts == _other.roundEntryCounts;
+		roundEntryCounts == _other.roundEntryCounts &&
+		evictions == _other.evictions;
 }
 
 Program ProgramCache::optimiseProgram(
@@ -60,31 +62,49 @@ Program ProgramCache::optimiseProgram(
 		targetOptimisations += _abbreviatedOptimisationSteps;
 
 	size_t prefixSize = 0;
-	for (size_t i = 1; i <= targetOptimisations.size(); ++i)
+	shared_ptr<Program const> prefixProgram = m_program;
 	{
-		auto const& pair = m_entries.find(targetOptimisations.substr(0, i));
-		if (pair != m_entries.end())
+		lock_guard<mutex> lock(m_mutex);
+
+		vector<Node*> path;
+		Node* node = &m_root;
+		for (char gene: targetOptimisations)
 		{
-			pair->second.roundNumber = m_currentRound;
-			++prefixSize;
-			++m_hits;
+			auto child = node->children.find(gene);
+			if (child == node->children.end())
+				break;
+
+			node = child->second.get();
+			path.push_back(node);
+			if (node->entry.has_value())
+			{
+				prefixSize = path.size();
+				prefixProgram = node->entry->program;
+			}
 		}
-		else
-			break;
+
+		// Mark the longest prefixes as used first so that the shorter ones, which are useful for
+		// more chromosomes, are the last to be evicted. Only prefixes that are still cached count
+		// as hits. The steps between them are neither served from the cache nor recomputed.
+		for (size_t i = prefixSize; i > 0; --i)
+			if (path[i - 1]->entry.has_value())
+			{
+				markAsUsed(*path[i - 1]);
+				++m_hits;
+			}
 	}
 
-	Program intermediateProgram = (
-		prefixSize == 0 ?
-		m_program :
-		m_entries.at(targetOptimisations.substr(0, prefixSize)).program
-	);
+	Program intermediateProgram = *prefixProgram;
 
 	for (size_t i = prefixSize + 1; i <= targetOptimisations.size(); ++i)
 	{
 		string stepName = OptimiserSuite::stepAbbreviationToNameMap().at(targetOptimisations[i - 1]);
 		intermediateProgram.optimise({stepName});
+		auto programCopy = make_shared<Program const>(intermediateProgram);
+		size_t codeSize = programCopy->codeSize(CacheStats::StorageWeights);
 
-		m_entries.insert({targetOptimisations.substr(0, i), {intermediateProgram, m_currentRound}});
+		lock_guard<mutex> lock(m_mutex);
+		insert(targetOptimisations.substr(0, i), move(programCopy), codeSize);
 		++m_misses;
 	}
 
@@ -96,30 +116,31 @@ void ProgramCache::startRound(size_t _roundNumber)
 	assert(_roundNumber > m_currentRound);
 	m_currentRound = _roundNumber;
 
-	for (auto pair = m_entries.begin(); pair != m_entries.end();)
+	for (auto position = m_recentlyUsed.begin(); position != m_recentlyUsed.end();)
 	{
-		assert(pair->second.roundNumber < m_currentRound);
+		Node* node = *position++;
+		assert(node->entry->roundNumber < m_currentRound);
 
-		if (pair->second.roundNumber < m_currentRound - 1)
-			m_entries.erase(pair++);
-		else
-			++pair;
+		if (node->entry->roundNumber < m_currentRound - 1)
+			removeEntry(*node);
 	}
 }
 
 void ProgramCache::clear()
 {
-	m_entries.clear();
+	m_root.children.clear();
+	m_recentlyUsed.clear();
+	m_totalCodeSize = 0;
 	m_currentRound = 0;
 }
 
 Program const* ProgramCache::find(string const& _abbreviatedOptimisationSteps) const
 {
-	auto const& pair = m_entries.find(_abbreviatedOptimisationSteps);
-	if (pair == m_entries.end())
+	Node const* node = findNode(_abbreviatedOptimisationSteps);
+	if (node == nullptr || !node->entry.has_value())
 		return nullptr;
 
-	return &(pair->second.program);
+	return node->entry->program.get();
 }
 
 CacheStats ProgramCache::gatherStats() const
@@ -127,28 +148,115 @@ CacheStats ProgramCache::gatherStats() const
 	return {
 		/* hits = */ m_hits,
 		/* misses = */ m_misses,
-		/* totalCodeSize = */ calculateTotalCachedCodeSize(),
+		/* totalCodeSize = */ m_totalCodeSize,
 		/* roundEntryCounts = */ countRoundEntries(),
+		/* evictions = */ m_evictions,
 	};
 }
 
-size_t ProgramCache::calculateTotalCachedCodeSize() const
+map<string, CacheEntry> ProgramCache::entries() const
 {
-	size_t size = 0;
-	for (auto const& pair: m_entries)
-		size += pair.second.program.codeSize(CacheStats::StorageWeights);
+	map<string, CacheEntry> result;
+	vector<pair<string, Node const*>> pendingNodes = {{"", &m_root}};
+	while (!pendingNodes.empty())
+	{
+		auto [steps, node] = move(pendingNodes.back());
+		pendingNodes.pop_back();
 
-	return size;
+		if (node->entry.has_value())
+			result.insert({steps, *node->entry});
+		for (auto const& [gene, child]: node->children)
+			pendingNodes.emplace_back(steps + gene, child.get());
+	}
+
+	return result;
+}
+
+ProgramCache::Node const* ProgramCache::findNode(string const& _abbreviatedOptimisationSteps) const
+{
+	Node const* node = &m_root;
+	for (char gene: _abbreviatedOptimisationSteps)
+	{
+		auto child = node->children.find(gene);
+		if (child == node->children.end())
+			return nullptr;
+
+		node = child->second.get();
+	}
+
+	return node;
+}
+
+void ProgramCache::insert(
+	string const& _abbreviatedOptimisationSteps,
+	shared_ptr<Program const> _program,
+	size_t _codeSize
+)
+{
+	Node* node = &m_root;
+	for (char gene: _abbreviatedOptimisationSteps)
+	{
+		unique_ptr<Node>& child = node->children[gene];
+		if (!child)
+		{
+			child = make_unique<Node>();
+			child->parent = node;
+		}
+		node = child.get();
+	}
+
+	// Another thread might have computed the same program in the meantime.
+	if (node->entry.has_value())
+		return;
+
+	node->entry = CacheEntry{move(_program), m_currentRound, _codeSize};
+	node->recentUse = m_recentlyUsed.insert(m_recentlyUsed.end(), node);
+	m_totalCodeSize += _codeSize;
+
+	if (m_maxTotalCodeSize.has_value())
+		while (m_totalCodeSize > m_maxTotalCodeSize.value() && !m_recentlyUsed.empty())
+		{
+			removeEntry(*m_recentlyUsed.front());
+			++m_evictions;
+		}
+}
+
+void ProgramCache::markAsUsed(Node& _node)
+{
+	assert(_node.entry.has_value());
+
+	_node.entry->roundNumber = m_currentRound;
+	m_recentlyUsed.splice(m_recentlyUsed.end(), m_recentlyUsed, _node.recentUse);
+}
+
+void ProgramCache::removeEntry(Node& _node)
+{
+	assert(_node.entry.has_value());
+
+	m_totalCodeSize -= _node.entry->codeSize;
+	m_recentlyUsed.erase(_node.recentUse);
+	_node.entry.reset();
+
+	// Remove nodes that no longer lead to any entry.
+	Node* node = &_node;
+	while (node != &m_root && !node->entry.has_value() && node->children.empty())
+	{
+		Node* parent = node->parent;
+		for (auto child = parent->children.begin(); child != parent->children.end(); ++child)
+			if (child->second.get() == node)
+			{
+				parent->children.erase(child);
+				break;
+			}
+		node = parent;
+	}
 }
 
 map<size_t, size_t> ProgramCache::countRoundEntries() const
 {
 	map<size_t, size_t> counts;
-	for (auto& pair: m_entries)
-		if (counts.find(pair.second.roundNumber) != counts.end())
-			++counts.at(pair.second.roundNumber);
-		else
-			counts.insert({pair.second.roundNumber, 1});
+	for (Node const* node: m_recentlyUsed)
+		++counts[node->entry->roundNumber];
 
 	return counts;
 }
@@ -22,7 +22,11 @@
 
 #include <libyul/optimiser/Metrics.h>
 
+#include <list>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 
 namespace solidity::phaser
@@ -34,12 +38,10 @@ namespace solidity::phaser
  */
 struct CacheEntry
 {
-	Program program;
+	std::shared_ptr<Program const> program;
 	size_t roundNumber;
-
-	CacheEntry(Program _program, size_t _roundNumber):
-		program(std::move(_program)),
-		roundNumber(_roundNumber) {}
+	/// Size of the program, measured using @a CacheStats::StorageWeights.
+	size_t codeSize;
 };
 
 /**
@@ -74,6 +76,9 @@ struct CacheStats
 	size_t misses;
 	size_t totalCodeSize;
 	std::map<size_t, size_t> roundEntryCounts;
+	/// Number of entries removed to stay within the size limit. Does not include entries
+	/// purged at the beginning of a round.
+	size_t evictions = 0;
 
 	CacheStats& operator+=(CacheStats const& _other);
 	CacheStats operator+(CacheStats const& _other) const { return CacheStats(*this) += _other; }
@@ -86,27 +91,34 @@ struct CacheStats
  * Class that optimises programs one step at a time which allows it to store and later reuse the
  * results of the intermediate steps.
  *
+ * Programs are stored in a trie of chromosome prefixes. Looking up the longest cached prefix of
+ * a chromosome takes one step per gene no matter how many entries there are and chromosomes
+ * sharing a prefix share the nodes that lead to it.
+ *
  * The cache keeps track of the current round number and associates newly created entries with it.
  * @a startRound() must be called at the beginning of a round so that entries that are too old
  * can be purged. The current strategy is to store programs corresponding to all possible prefixes
  * encountered in the current and the previous rounds. Entries older than that get removed to
  * conserve memory.
  *
- * @a gatherStats() allows getting statistics useful for determining cache effectiveness.
+ * The total size of cached programs can also be limited. The size is measured the same way as
+ * @a CacheStats::totalCodeSize. When an insertion makes the cache exceed the limit, the least
+ * recently used entries get evicted until it fits again. Evicting a prefix does not affect longer
+ * prefixes stored in the cache. Lookups simply skip the missing nodes.
  *
- * The current strategy does speed things up (about 4:1 hit:miss ratio observed in my limited
- * experiments) but there's room for improvement. We could fit more useful programs in
- * the cache by being more picky about which ones we choose.
+ * @a gatherStats() allows getting statistics useful for determining cache effectiveness.
  *
- * There is currently no way to purge entries without starting a new round. Since the programs
- * take a lot of memory, this may lead to the cache eating up all the available RAM if sequences are
- * long and programs large. A limiter based on entry count or total program size would be useful.
+ * @a optimiseProgram() can be called from multiple threads at the same time. Intermediate programs
+ * are computed outside of the lock, so two threads may occasionally compute the same entry.
+ * The result is the same either way but hit and miss counts may vary between runs. All the other
+ * methods must not be called while an optimisation is in progress.
  */
 class ProgramCache
 {
 public:
-	explicit ProgramCache(Program _program):
-		m_program(std::move(_program)) {}
+	explicit ProgramCache(Program _program, std::optional<size_t> _maxTotalCodeSize = std::nullopt):
+		m_program(std::make_shared<Program const>(std::move(_program))),
+		m_maxTotalCodeSize(_maxTotalCodeSize) {}
 
 	Program optimiseProgram(
 		std::string const& _abbreviatedOptimisationSteps,
@@ -115,29 +127,48 @@ public:
 	void startRound(size_t _nextRoundNumber);
 	void clear();
 
-	size_t size() const { return m_entries.size(); }
+	size_t size() const { return m_recentlyUsed.size(); }
 	Program const* find(std::string const& _abbreviatedOptimisationSteps) const;
 	bool contains(std::string const& _abbreviatedOptimisationSteps) const { return find(_abbreviatedOptimisationSteps) != nullptr; }
 
 	CacheStats gatherStats() const;
 
-	std::map<std::string, CacheEntry> const& entries() const { return m_entries; }
-	Program const& program() const { return m_program; }
+	/// @returns all the entries, keyed by the optimisation steps they correspond to.
+	/// The programs are shared with the cache rather than copied.
+	std::map<std::string, CacheEntry> entries() const;
+	Program const& program() const { return *m_program; }
 	size_t currentRound() const { return m_currentRound; }
+	std::optional<size_t> maxTotalCodeSize() const { return m_maxTotalCodeSize; }
 
 private:
-	size_t calculateTotalCachedCodeSize() const;
+	struct Node
+	{
+		Node* parent = nullptr;
+		std::map<char, std::unique_ptr<Node>> children;
+		std::optional<CacheEntry> entry;
+		/// Position in @a m_recentlyUsed. Valid only if the node has an entry.
+		std::list<Node*>::iterator recentUse;
+	};
+
+	Node const* findNode(std::string const& _abbreviatedOptimisationSteps) const;
+	void insert(std::string const& _abbreviatedOptimisationSteps, std::shared_ptr<Program const> _program, size_t _codeSize);
+	void markAsUsed(Node& _node);
+	void removeEntry(Node& _node);
 	std::map<size_t, size_t> countRoundEntries() const;
 
-	// The best matching data structure here would be a trie of chromosome prefixes but since
-	// the programs are orders of magnitude larger than the prefixes, it does not really matter.
-	// A map should be good enough.
-	std::map<std::string, CacheEntry> m_entries;
+	Node m_root;
+	/// Nodes that have entries, from the least to the most recently used one.
+	std::list<Node*> m_recentlyUsed;
 
-	Program m_program;
+	std::shared_ptr<Program const> m_program;
+	std::optional<size_t> m_maxTotalCodeSize;
+	/// Guards the trie and the counters while @a optimiseProgram() is executing.
+	std::mutex m_mutex;
 	size_t m_currentRound = 0;
+	size_t m_totalCodeSize = 0;
 	size_t m_hits = 0;
 	size_t m_misses = 0;
+	size_t m_evictions = 0;
 };
 
 }